@@ -151,6 +151,14 @@ class V8_EXPORT Heap {
      * GC scheduler follows.
      */
     ResourceConstraints resource_constraints;
+
+    /**
+     * Enables generational garbage collection. Objects surviving a garbage
+     * collection are considered old and are not re-marked by young garbage
+     * collections (see `ForceYoungGarbageCollectionSlow()`). Has no effect
+     * unless the library is built with `cppgc_enable_young_generation`.
+     */
+    bool young_generation_support = false;
   };
 
   /**
@@ -179,6 +187,22 @@ class V8_EXPORT Heap {
       const char* source, const char* reason,
       StackState stack_state = StackState::kMayContainHeapPointers);
 
+  /**
+   * Forces a garbage collection of the young generation, i.e., only objects
+   * allocated since the last garbage collection are considered for
+   * reclamation. Falls back to a full garbage collection if generational
+   * garbage collection is not (yet) active on this heap.
+   *
+   * \param source String specifying the source (or caller) triggering a
+   *   forced garbage collection.
+   * \param reason String specifying the reason for the forced garbage
+   *   collection.
+   * \param stack_state The embedder stack state, see StackState.
+   */
+  void ForceYoungGarbageCollectionSlow(
+      const char* source, const char* reason,
+      StackState stack_state = StackState::kMayContainHeapPointers);
+
   /**
    * \returns the opaque handle for allocating objects using
    * `MakeGarbageCollected()`.
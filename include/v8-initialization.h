@@ -287,6 +287,15 @@ class V8_EXPORT V8 {
    */
   static void GetSharedMemoryStatistics(SharedMemoryStatistics* statistics);
 
+  /**
+   * Sets a budget in bytes for the old generations of all isolates in the
+   * process that use the memory balancer (--memory-balancer). Instead of each
+   * heap tuning its limit alone, the memory above the live memory of all heaps
+   * is distributed according to each heap's allocation rate and GC speed.
+   * Passing 0 disables the process-wide budget.
+   */
+  static void SetProcessMemoryBudget(size_t budget_in_bytes);
+
  private:
   V8();
 
@@ -1543,6 +1543,17 @@ class V8_EXPORT Isolate {
    */
   void SetIsLoading(bool is_loading);
 
+  /**
+   * Optional notification of the maximum duration in milliseconds the
+   * embedder wants stop-the-world garbage collection pauses to take, e.g. the
+   * slack of a frame or request deadline. V8 sizes incremental marking steps
+   * and the compaction work done in a single pause against this budget and
+   * records pauses exceeding it. Passing 0 restores the default heuristics.
+   * This is an unfinished experimental feature. Semantics and implementation
+   * may change frequently.
+   */
+  void SetGCPauseBudget(double milliseconds);
+
   /**
    * Optional notification to tell V8 whether the embedder is currently frozen.
    * V8 uses these notifications to guide heuristics.
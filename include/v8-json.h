@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8-message.h"       // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -22,6 +23,21 @@ class String;
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * Receives the UTF-8 encoded output of StringifyToUtf8.
+   */
+  class V8_EXPORT OutputSink {
+   public:
+    virtual ~OutputSink() = default;
+
+    /**
+     * Called with consecutive chunks of the serialized value. |data| is only
+     * valid for the duration of the call. Implementations must not call into
+     * V8 or allocate on the JavaScript heap from within Write.
+     */
+    virtual void Write(const char* data, size_t length) = 0;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -32,6 +48,14 @@ class V8_EXPORT JSON {
    * If not provided, error reporting will use default origin options
    * or attempt to infer origin from the current stack.
    * \return The corresponding value if successfully parsed.
+   *
+   * The parser operates on flat strings. Cons strings (e.g. the result of
+   * concatenating input chunks) are flattened first, which temporarily
+   * requires memory for both the chunks and the flat copy. Embedders that
+   * receive large inputs in chunks can avoid the on-heap copy by assembling
+   * the chunks into their own buffer and passing it as an external string
+   * (see String::NewExternalOneByte and String::NewExternalTwoByte), which is
+   * parsed in place.
    */
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string,
@@ -47,6 +71,21 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Serializes |json_object| like Stringify (without gap) and writes the
+   * UTF-8 encoded result to |sink| instead of creating a string, avoiding the
+   * intermediate on-heap string and the subsequent transcoding.
+   *
+   * Lone surrogates cannot occur in the output as they are escaped by the
+   * serializer. Data is only passed to |sink| once serialization succeeded.
+   *
+   * \return true if the value was serialized, false if it is not
+   * JSON-serializable (i.e. Stringify would return undefined), or nothing if
+   * an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, OutputSink* sink);
 };
 
 }  // namespace v8
@@ -10,6 +10,7 @@
 #include "v8-internal.h"           // NOLINT(build/include_directory)
 #include "v8-local-handle.h"       // NOLINT(build/include_directory)
 #include "v8-maybe.h"              // NOLINT(build/include_directory)
+#include "v8-memory-span.h"        // NOLINT(build/include_directory)
 #include "v8-persistent-handle.h"  // NOLINT(build/include_directory)
 #include "v8-primitive.h"          // NOLINT(build/include_directory)
 #include "v8-sandbox.h"            // NOLINT(build/include_directory)
@@ -313,6 +314,35 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the values of the properties named by |keys| and stores them in
+   * |values|, which must have the same size as |keys|. This behaves like
+   * calling Get for every key in order, but enters V8 only once, which makes
+   * reading many properties of e.g. an options object considerably cheaper.
+   * The values are created in the current HandleScope.
+   *
+   * In builds with direct handles, |values| must be on the stack or be backed
+   * by a LocalVector, so that the garbage collector finds the stored values.
+   *
+   * If a getter throws, its exception is thrown, Nothing is returned and
+   * |values| is left unchanged.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> GetMany(Local<Context> context,
+                                            MemorySpan<const Local<Name>> keys,
+                                            MemorySpan<Local<Value>> values);
+
+  /**
+   * Sets the properties named by |keys| to the corresponding entries of
+   * |values|, which must have the same size as |keys|. This behaves like
+   * calling Set for every key in order, but enters V8 only once.
+   *
+   * If a setter throws, its exception is thrown and Nothing is returned. The
+   * properties before the failing one have been set at that point.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> SetMany(
+      Local<Context> context, MemorySpan<const Local<Name>> keys,
+      MemorySpan<const Local<Value>> values);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
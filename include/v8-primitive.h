@@ -21,6 +21,7 @@ namespace internal {
 class ExternalString;
 class ScopedExternalStringLock;
 class StringForwardingTable;
+class Utf8StreamDecoder;
 }  // namespace internal
 
 /**
@@ -266,6 +267,21 @@ class V8_EXPORT String : public Name {
                      int flags = WriteFlags::kNone,
                      size_t* processed_characters_return = nullptr) const;
 
+  /**
+   * Encodes the |count| strings in |strings| as UTF-8 into |buffer|, back to
+   * back, and stores the number of bytes written for each string (including
+   * the null terminator, if requested) in |lengths|. Each string is written as
+   * by WriteUtf8V2, but V8 is only entered once for the whole batch.
+   *
+   * Writing stops before the first string that does not fit completely into
+   * the remaining capacity of the buffer.
+   *
+   * \return The number of strings that were written completely.
+   */
+  static size_t WriteUtf8Batch(Isolate* isolate, const Local<String>* strings,
+                               size_t count, char* buffer, size_t capacity,
+                               size_t* lengths, int flags = WriteFlags::kNone);
+
   /**
    * A zero length string.
    */
@@ -536,6 +552,21 @@ class V8_EXPORT String : public Name {
       Isolate* isolate, const char* data,
       NewStringType type = NewStringType::kNormal, int length = -1);
 
+  /**
+   * Allocates a new string from the UTF-8 data of each of the |count| entries
+   * in |data| and |lengths|, and stores them in |results|. A length of -1
+   * means that the data is null-terminated. This is equivalent to calling
+   * NewFromUtf8 for each entry, but V8 is only entered once for the whole
+   * batch.
+   *
+   * Returns false without creating any strings if a length exceeds
+   * kMaxLength.
+   */
+  static V8_WARN_UNUSED_RESULT bool NewFromUtf8Batch(
+      Isolate* isolate, const char* const* data, const int* lengths,
+      size_t count, Local<String>* results,
+      NewStringType type = NewStringType::kNormal);
+
   /** Allocates a new string from Latin-1 data.  Only returns an empty value
    * when length > kMaxLength. **/
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewFromOneByte(
@@ -600,6 +631,20 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource.
+   * If the data is ASCII-only, it is also valid one-byte data and the resource
+   * is used directly as backing store of an external one-byte string, without
+   * copying; see NewExternalOneByte for the lifetime of the resource in that
+   * case. Otherwise the data is decoded into a new, non-external string and
+   * the resource is disposed before this function returns.
+   *
+   * Only returns an empty value when the length exceeds kMaxLength, in which
+   * case the resource is not disposed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalFromUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -740,6 +785,42 @@ class V8_EXPORT String : public Name {
         [internal::Internals::kDisallowGarbageCollectionSize];
   };
 
+  /**
+   * Decodes UTF-8 data that is received in chunks into a single string, e.g.
+   * for streaming network input. Chunks may split multi-byte sequences at
+   * arbitrary positions; the resulting string is the same as the one
+   * NewFromUtf8 returns for the concatenated input. The decoded characters are
+   * kept off-heap until Finish is called, so no intermediate strings are
+   * created.
+   */
+  class V8_EXPORT Utf8StreamDecoder {
+   public:
+    Utf8StreamDecoder();
+    ~Utf8StreamDecoder();
+
+    /**
+     * Decodes the next |length| bytes of input. The data is not retained and
+     * may be released after the call.
+     */
+    void Append(const char* data, size_t length);
+
+    /**
+     * Terminates the input and returns the decoded string. An incomplete
+     * multi-byte sequence at the end of the input is replaced by U+FFFD. The
+     * decoder is reset and can be reused for the next input afterwards. Only
+     * returns an empty value when the decoded length exceeds kMaxLength.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<String> Finish(
+        Isolate* isolate, NewStringType type = NewStringType::kNormal);
+
+    // Disallow copying and assigning.
+    Utf8StreamDecoder(const Utf8StreamDecoder&) = delete;
+    void operator=(const Utf8StreamDecoder&) = delete;
+
+   private:
+    internal::Utf8StreamDecoder* decoder_;
+  };
+
  private:
   void VerifyExternalStringResourceBase(ExternalStringResourceBase* v,
                                         Encoding encoding) const;
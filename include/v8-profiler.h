@@ -1283,6 +1283,19 @@ enum CodeEventType {
 #undef V
 };
 
+/**
+ * The execution tier of the code reported by a CodeEvent. Note that this enum
+ * may be extended in the future. Please include a default case if this enum is
+ * used in a switch statement.
+ */
+enum class CodeEventTier {
+  kUnknown = 0,
+  kInterpreter,
+  kBaseline,
+  kMaglev,
+  kTurbofan,
+};
+
 /**
  * Representation of a code creation event
  */
@@ -1301,6 +1314,13 @@ class V8_EXPORT CodeEvent {
    */
   CodeEventType GetCodeType();
   const char* GetComment();
+  /**
+   * Returns the tier that produced the code, which together with
+   * GetCodeSize() allows attributing code space per function and tier.
+   * Returns kUnknown for code not compiled from JavaScript functions (e.g.
+   * builtins, regexps) and for relocation events.
+   */
+  CodeEventTier GetCodeTier();
 
   static const char* GetCodeEventTypeName(CodeEventType code_event_type);
 
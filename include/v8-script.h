@@ -791,6 +791,29 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * Compiles a batch of classic scripts (bound to current context).
+   *
+   * Sources whose source string is an external string are parsed and
+   * compiled as script streaming tasks distributed across the platform's
+   * worker threads, reading the string in place. All other sources are
+   * compiled on the calling thread meanwhile, sources with cached data using
+   * kConsumeCodeCache. The scripts are finalized on the calling thread in
+   * order.
+   *
+   * |options| applies to all sources without cached data and must not
+   * contain kConsumeCodeCache. Compile hint callbacks are taken from each
+   * source.
+   *
+   * |scripts| must have the same size as |sources|. If compiling a script
+   * fails, its exception is thrown and Nothing is returned; the entries in
+   * |scripts| from the failing script on are left empty.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<void> CompileBatch(
+      Local<Context> context, MemorySpan<Source* const> sources,
+      MemorySpan<Local<Script>> scripts,
+      CompileOptions options = kNoCompileOptions);
+
   /**
    * Return a version tag for CachedData for the current V8 version & flags.
    *
@@ -874,6 +897,45 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Combines the code caches of several scripts into a single bundle, e.g. to
+   * store them in one file. Entries are laid out at pointer-aligned offsets so
+   * that a bundle which is mapped into memory at an aligned address (e.g. via
+   * mmap) can be consumed without copying. The CachedData returned by this
+   * function should be owned by the caller.
+   */
+  static CachedData* CreateCodeCacheBundle(
+      MemorySpan<const CachedData* const> caches);
+
+  /**
+   * Returns the code cache at |index| of a bundle created by
+   * CreateCodeCacheBundle, or nullptr if |bundle| is malformed or |index| is
+   * out of range. The returned CachedData references the memory of |bundle|,
+   * which has to outlive it. Only the bundle index is validated here; each
+   * entry is checked when it is consumed.
+   */
+  static CachedData* GetCodeCacheFromBundle(const CachedData* bundle,
+                                            size_t index);
+
+  /**
+   * Creates and returns the pretenuring decisions V8 made for object and array
+   * literals of the specified unbound_script, e.g. to be stored alongside its
+   * code cache. Passing them to SetPretenuringHints for the same script in
+   * another process lets literals be allocated in old space right away instead
+   * of relearning the decisions. The CachedData returned by this function
+   * should be owned by the caller.
+   */
+  static CachedData* CreatePretenuringHints(Local<UnboundScript> unbound_script);
+
+  /**
+   * Applies pretenuring decisions created by CreatePretenuringHints to the
+   * specified unbound_script. This should be called right after compiling the
+   * script and before running it. Returns false if |hints| were malformed or
+   * created for a different script.
+   */
+  static bool SetPretenuringHints(Local<UnboundScript> unbound_script,
+                                  const CachedData* hints);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -190,6 +190,17 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to move large strings into the shared heap and pass them
+   * through the SharedValueConveyor instead of copying their contents into the
+   * buffer. This only has an effect if the isolate has a shared heap and
+   * --shared-string-table is enabled, and requires the Delegate to support
+   * AdoptSharedValueConveyor.
+   *
+   * The default is to copy strings.
+   */
+  void SetShareLargeStrings(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
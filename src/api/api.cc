@@ -39,6 +39,7 @@
 #include "src/base/numerics/safe_conversions.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
 #include "src/base/template-utils.h"
 #include "src/base/utils/random-number-generator.h"
@@ -59,6 +60,7 @@
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/local-isolate-inl.h"
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
 #include "src/execution/simulator.h"
@@ -68,9 +70,13 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/memory-balancer.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/visit-object.h"
 #include "src/init/bootstrapper.h"
@@ -137,6 +143,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -2684,6 +2691,168 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   return api_scope.Escape(generic->BindToCurrentContext());
 }
 
+namespace {
+
+// Creates a streamed source that reads an external string in place. The
+// characters of external strings live off-heap and never move, so the
+// background parser can access them without a copy.
+std::unique_ptr<ScriptCompiler::StreamedSource> NewExternalStringStreamedSource(
+    i::Isolate* i_isolate, i::Handle<i::String> source) {
+  DCHECK(i::IsExternalString(*source));
+  auto streamed_source = std::make_unique<ScriptCompiler::StreamedSource>(
+      nullptr, source->IsOneByteRepresentation()
+                   ? ScriptCompiler::StreamedSource::ONE_BYTE
+                   : ScriptCompiler::StreamedSource::TWO_BYTE);
+  streamed_source->impl()->character_stream.reset(
+      i::ScannerStream::For(i_isolate, source));
+  return streamed_source;
+}
+
+// A streaming task of a batch. |done| is signaled once the task has run.
+struct BatchStreamingTask {
+  std::unique_ptr<ScriptCompiler::ScriptStreamingTask> task;
+  base::Semaphore done{0};
+};
+
+// Runs the streaming tasks of a batch on worker threads.
+class BatchStreamingJob final : public v8::JobTask {
+ public:
+  explicit BatchStreamingJob(std::vector<BatchStreamingTask>* tasks)
+      : tasks_(tasks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      const size_t index = next_task_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= tasks_->size()) return;
+      BatchStreamingTask& task = (*tasks_)[index];
+      task.task->Run();
+      task.done.Signal();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next_task = next_task_.load(std::memory_order_relaxed);
+    return next_task >= tasks_->size() ? 0 : tasks_->size() - next_task;
+  }
+
+ private:
+  std::vector<BatchStreamingTask>* const tasks_;
+  std::atomic<size_t> next_task_{0};
+};
+
+}  // namespace
+
+Maybe<void> ScriptCompiler::CompileBatch(Local<Context> context,
+                                         MemorySpan<Source* const> sources,
+                                         MemorySpan<Local<Script>> scripts,
+                                         CompileOptions options) {
+  Utils::ApiCheck(sources.size() == scripts.size(),
+                  "v8::ScriptCompiler::CompileBatch",
+                  "sources and scripts must have the same size");
+  Utils::ApiCheck(
+      sources.size() <= static_cast<size_t>(i::FixedArray::kMaxLength),
+      "v8::ScriptCompiler::CompileBatch", "too many sources");
+  Utils::ApiCheck(v8::ScriptCompiler::CompileOptionsIsValid(options) &&
+                      (options & kConsumeCodeCache) == 0,
+                  "v8::ScriptCompiler::CompileBatch", "Invalid CompileOptions");
+  for (Source* source : sources) {
+    Utils::ApiCheck(!source->GetResourceOptions().IsModule(),
+                    "v8::ScriptCompiler::CompileBatch",
+                    "Only classic scripts are supported");
+  }
+  i::Isolate* i_isolate = i::Isolate::Current();
+  Local<FixedArray> results;
+  size_t compiled_count = 0;
+  {
+    PrepareForExecutionScope api_scope{i_isolate, context,
+                                       RCCId::kAPI_ScriptCompiler_Compile};
+    TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.ScriptCompiler");
+    TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.CompileScriptBatch", "count", sources.size());
+
+    // Sources backed by external strings are compiled on worker threads. All
+    // other sources, including those with cached data, are compiled on this
+    // thread while the workers run.
+    std::vector<std::unique_ptr<StreamedSource>> streamed_sources(
+        sources.size());
+    std::vector<size_t> task_indices(sources.size());
+    size_t task_count = 0;
+    if (i::v8_flags.script_streaming &&
+        V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0) {
+      for (size_t i = 0; i < sources.size(); i++) {
+        Source* source = sources[i];
+        if (source->cached_data) continue;
+        i::Handle<i::String> source_string = i::String::Flatten(
+            i_isolate, Utils::OpenHandle(*source->source_string));
+        if (!i::IsExternalString(*source_string)) continue;
+        streamed_sources[i] =
+            NewExternalStringStreamedSource(i_isolate, source_string);
+        task_indices[i] = task_count++;
+      }
+    }
+    std::vector<BatchStreamingTask> tasks(task_count);
+    std::unique_ptr<JobHandle> job;
+    if (task_count > 0) {
+      for (size_t i = 0; i < sources.size(); i++) {
+        if (!streamed_sources[i]) continue;
+        Source* source = sources[i];
+        tasks[task_indices[i]].task.reset(StartStreaming(
+            reinterpret_cast<Isolate*>(i_isolate), streamed_sources[i].get(),
+            ScriptType::kClassic, options, source->compile_hint_callback,
+            source->compile_hint_callback_data));
+      }
+      job = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<BatchStreamingJob>(&tasks));
+    }
+
+    // Finalize all scripts in order.
+    i::DirectHandle<i::FixedArray> array =
+        i_isolate->factory()->NewFixedArray(static_cast<int>(sources.size()));
+    for (size_t i = 0; i < sources.size(); i++) {
+      Source* source = sources[i];
+      MaybeLocal<Script> maybe_script;
+      if (streamed_sources[i]) {
+        // Background compilation uses LocalHeaps, so the main thread must not
+        // block safepoints while waiting.
+        base::Semaphore* done = &tasks[task_indices[i]].done;
+        i_isolate->main_thread_local_isolate()->ExecuteMainThreadWhileParked(
+            [done]() { done->Wait(); });
+        ScriptOrigin origin(
+            source->resource_name, source->resource_line_offset,
+            source->resource_column_offset,
+            source->resource_options.IsSharedCrossOrigin(), -1,
+            source->source_map_url, source->resource_options.IsOpaque(),
+            source->resource_options.IsWasm(), false,
+            source->host_defined_options);
+        maybe_script = Compile(context, streamed_sources[i].get(),
+                               source->source_string, origin);
+      } else {
+        maybe_script =
+            Compile(context, source,
+                    source->cached_data ? kConsumeCodeCache : options);
+      }
+      Local<Script> script;
+      if (!maybe_script.ToLocal(&script)) break;
+      array->set(static_cast<int>(i), *Utils::OpenDirectHandle(*script));
+      compiled_count++;
+    }
+    if (job) {
+      // Tasks that didn't start yet after a failure are dropped.
+      i_isolate->main_thread_local_isolate()->ExecuteMainThreadWhileParked(
+          [&job]() { job->Cancel(); });
+    }
+    results = api_scope.Escape(Utils::FixedArrayToLocal(array));
+  }
+  i::DirectHandle<i::FixedArray> array = Utils::OpenDirectHandle(*results);
+  for (size_t i = 0; i < compiled_count; i++) {
+    scripts[i] = ToApiHandle<Script>(
+        i::direct_handle(array->get(static_cast<int>(i)), i_isolate));
+  }
+  if (compiled_count < sources.size()) return Nothing<void>();
+  return JustVoid();
+}
+
 MaybeLocal<Module> ScriptCompiler::CompileModule(
     Local<Context> context, StreamedSource* v8_source,
     Local<String> full_source_string, const ScriptOrigin& origin) {
@@ -2752,6 +2921,51 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheBundle(
+    MemorySpan<const CachedData* const> caches) {
+  return i::CodeCacheBundle::Create(
+      base::VectorOf(caches.data(), caches.size()));
+}
+
+// static
+ScriptCompiler::CachedData* ScriptCompiler::GetCodeCacheFromBundle(
+    const CachedData* bundle, size_t index) {
+  base::Vector<const uint8_t> entry = i::CodeCacheBundle::GetEntry(
+      base::VectorOf(bundle->data, static_cast<size_t>(bundle->length)),
+      index);
+  if (entry.empty()) return nullptr;
+  return new CachedData(entry.begin(), static_cast<int>(entry.size()),
+                        CachedData::BufferNotOwned);
+}
+
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreatePretenuringHints(
+    Local<UnboundScript> unbound_script) {
+  auto shared = Utils::OpenDirectHandle(*unbound_script);
+  i::Isolate* i_isolate = i::Isolate::Current();
+  DCHECK(shared->is_toplevel());
+  i::DirectHandle<i::Script> script(i::Cast<i::Script>(shared->script()),
+                                    i_isolate);
+  base::OwnedVector<uint8_t> hints =
+      i::PretenuringHandler::SerializePretenuringHints(i_isolate, script);
+  const int length = static_cast<int>(hints.size());
+  return new CachedData(hints.ReleaseData().release(), length,
+                        CachedData::BufferOwned);
+}
+
+// static
+bool ScriptCompiler::SetPretenuringHints(Local<UnboundScript> unbound_script,
+                                         const CachedData* hints) {
+  auto shared = Utils::OpenDirectHandle(*unbound_script);
+  i::Isolate* i_isolate = i::Isolate::Current();
+  DCHECK(shared->is_toplevel());
+  i::DirectHandle<i::Script> script(i::Cast<i::Script>(shared->script()),
+                                    i_isolate);
+  return i_isolate->heap()->pretenuring_handler()->SetPretenuringHints(
+      script, base::VectorOf(hints->data, static_cast<size_t>(hints->length)));
+}
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -3252,6 +3466,23 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   return api_scope.EscapeMaybe(i::Object::ToString(i_isolate, maybe));
 }
 
+Maybe<bool> JSON::StringifyToUtf8(Local<Context> context,
+                                  Local<Value> json_object,
+                                  OutputSink* sink) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Stringify};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  i::Handle<i::JSAny> object;
+  if (!Utils::ApiCheck(
+          i::TryCast<i::JSAny>(Utils::OpenHandle(*json_object), &object),
+          "JSON::StringifyToUtf8",
+          "Invalid object, must be a JSON-serializable object.")) {
+    return Nothing<bool>();
+  }
+  Utils::ApiCheck(sink != nullptr, "JSON::StringifyToUtf8",
+                  "Sink must not be null");
+  return i::JsonStringifyToUtf8(i_isolate, object, sink);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3345,6 +3576,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetShareLargeStrings(bool mode) {
+  private_->serializer.SetShareLargeStrings(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = i::Isolate::Current();
@@ -4594,6 +4829,65 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
       i::JSReceiver::GetElement(i_isolate, self, index));
 }
 
+Maybe<void> v8::Object::GetMany(Local<Context> context,
+                                MemorySpan<const Local<Name>> keys,
+                                MemorySpan<Local<Value>> values) {
+  Utils::ApiCheck(keys.size() == values.size(), "v8::Object::GetMany",
+                  "keys and values must have the same size");
+  Utils::ApiCheck(keys.size() <= static_cast<size_t>(i::FixedArray::kMaxLength),
+                  "v8::Object::GetMany", "too many keys");
+  i::Isolate* i_isolate = i::Isolate::Current();
+  Local<FixedArray> results;
+  {
+    PrepareForExecutionScope api_scope{i_isolate, context,
+                                       RCCId::kAPI_Object_Get};
+    auto self = Utils::OpenDirectHandle(this);
+    i::DirectHandle<i::FixedArray> array =
+        i_isolate->factory()->NewFixedArray(static_cast<int>(keys.size()));
+    for (size_t i = 0; i < keys.size(); i++) {
+      // Don't leak the handles created by the lookup of each key.
+      i::HandleScope key_scope(i_isolate);
+      i::DirectHandle<i::Object> value;
+      if (!i::Runtime::GetObjectProperty(i_isolate, self,
+                                         Utils::OpenDirectHandle(*keys[i]))
+               .ToHandle(&value)) {
+        return Nothing<void>();
+      }
+      array->set(static_cast<int>(i), *value);
+    }
+    results = api_scope.Escape(Utils::FixedArrayToLocal(array));
+  }
+  i::DirectHandle<i::FixedArray> array = Utils::OpenDirectHandle(*results);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = Utils::ToLocal(
+        i::direct_handle(array->get(static_cast<int>(i)), i_isolate));
+  }
+  return JustVoid();
+}
+
+Maybe<void> v8::Object::SetMany(Local<Context> context,
+                                MemorySpan<const Local<Name>> keys,
+                                MemorySpan<const Local<Value>> values) {
+  Utils::ApiCheck(keys.size() == values.size(), "v8::Object::SetMany",
+                  "keys and values must have the same size");
+  auto i_isolate = i::Isolate::Current();
+  EnterV8Scope<> api_scope{i_isolate, context, RCCId::kAPI_Object_Set};
+  auto self = Utils::OpenDirectHandle(this);
+  for (size_t i = 0; i < keys.size(); i++) {
+    // Don't leak the handles created by the lookup of each key.
+    i::HandleScope key_scope(i_isolate);
+    i::PropertyKey lookup_key(i_isolate, Utils::OpenDirectHandle(*keys[i]));
+    i::LookupIterator it(i_isolate, self, lookup_key);
+    if (i::Object::SetProperty(&it, Utils::OpenDirectHandle(*values[i]),
+                               i::StoreOrigin::kMaybeKeyed,
+                               Just(i::ShouldThrow::kDontThrow))
+            .IsNothing()) {
+      return Nothing<void>();
+    }
+  }
+  return JustVoid();
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, key.UnsafeAs<Value>());
@@ -5951,6 +6245,38 @@ size_t String::WriteUtf8V2(Isolate* v8_isolate, char* buffer, size_t capacity,
                               processed_characters_return);
 }
 
+// static
+size_t String::WriteUtf8Batch(Isolate* v8_isolate,
+                              const Local<String>* strings, size_t count,
+                              char* buffer, size_t capacity, size_t* lengths,
+                              int flags) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ApiRuntimeCallStatsScope rcs_scope(i_isolate, RCCId::kAPI_String_WriteUtf8);
+  EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+  i::String::Utf8EncodingFlags i_flags;
+  if (flags & String::WriteFlags::kNullTerminate) {
+    i_flags |= i::String::Utf8EncodingFlag::kNullTerminate;
+  }
+  if (flags & String::WriteFlags::kReplaceInvalidUtf8) {
+    i_flags |= i::String::Utf8EncodingFlag::kReplaceInvalid;
+  }
+  size_t offset = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto str = Utils::OpenDirectHandle(*strings[i]);
+    const bool needs_space =
+        str->length() > 0 || (flags & String::WriteFlags::kNullTerminate);
+    if (needs_space && offset == capacity) return i;
+    size_t processed_characters = 0;
+    const size_t written =
+        i::String::WriteUtf8(i_isolate, str, buffer + offset, capacity - offset,
+                             i_flags, &processed_characters);
+    if (processed_characters < str->length()) return i;
+    lengths[i] = written;
+    offset += written;
+  }
+  return count;
+}
+
 namespace {
 
 bool HasExternalStringResource(i::Tagged<i::String> string) {
@@ -6637,6 +6963,10 @@ void V8::GetSharedMemoryStatistics(SharedMemoryStatistics* statistics) {
   i::ReadOnlyHeap::PopulateReadOnlySpaceStatistics(statistics);
 }
 
+void V8::SetProcessMemoryBudget(size_t budget_in_bytes) {
+  i::MemoryBalancer::SetProcessMemoryBudget(budget_in_bytes);
+}
+
 template <typename ObjectType>
 struct InvokeBootstrapper;
 
@@ -7644,6 +7974,71 @@ MaybeLocal<String> String::NewFromUtf8(Isolate* v8_isolate, const char* data,
   return result;
 }
 
+bool String::NewFromUtf8Batch(Isolate* v8_isolate, const char* const* data,
+                              const int* lengths, size_t count,
+                              Local<String>* results, NewStringType type) {
+  // Resolve and validate every length before allocating anything, so that a
+  // failing batch leaves the heap untouched.
+  std::vector<int> resolved_lengths(count);
+  for (size_t i = 0; i < count; i++) {
+    size_t length = lengths[i] < 0 ? strlen(data[i])
+                                   : static_cast<size_t>(lengths[i]);
+    if (length > i::String::kMaxLength) return false;
+    resolved_lengths[i] = static_cast<int>(length);
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+  ApiRuntimeCallStatsScope rcs_scope(i_isolate,
+                                     RCCId::kAPI_String_NewFromUtf8);
+  for (size_t i = 0; i < count; i++) {
+    int length = resolved_lengths[i];
+    if (length == 0) {
+      results[i] = String::Empty(v8_isolate);
+      continue;
+    }
+    i::DirectHandle<i::String> result =
+        NewString(i_isolate->factory(), type,
+                  base::Vector<const char>(data[i], length))
+            .ToHandleChecked();
+    results[i] = Utils::ToLocal(result);
+  }
+  return true;
+}
+
+String::Utf8StreamDecoder::Utf8StreamDecoder()
+    : decoder_(new i::Utf8StreamDecoder()) {}
+
+String::Utf8StreamDecoder::~Utf8StreamDecoder() { delete decoder_; }
+
+void String::Utf8StreamDecoder::Append(const char* data, size_t length) {
+  decoder_->Append(
+      base::Vector<const uint8_t>(reinterpret_cast<const uint8_t*>(data),
+                                  length));
+}
+
+MaybeLocal<String> String::Utf8StreamDecoder::Finish(Isolate* v8_isolate,
+                                                     NewStringType type) {
+  decoder_->Finish();
+  MaybeLocal<String> result;
+  if (decoder_->length() == 0) {
+    result = String::Empty(v8_isolate);
+  } else if (decoder_->length() <= i::String::kMaxLength) {
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+    EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+    ApiRuntimeCallStatsScope rcs_scope(
+        i_isolate, RCCId::kAPI_String_Utf8StreamDecoder_Finish);
+    i::DirectHandle<i::String> handle_result =
+        (decoder_->is_one_byte()
+             ? NewString(i_isolate->factory(), type, decoder_->one_byte_data())
+             : NewString(i_isolate->factory(), type,
+                         decoder_->two_byte_data()))
+            .ToHandleChecked();
+    result = Utils::ToLocal(handle_result);
+  }
+  decoder_->Reset();
+  return result;
+}
+
 MaybeLocal<String> String::NewFromOneByte(Isolate* v8_isolate,
                                           const uint8_t* data,
                                           NewStringType type, int length) {
@@ -7727,6 +8122,43 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalFromUtf8(
+    Isolate* v8_isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return {};
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+  ApiRuntimeCallStatsScope rcs_scope(i_isolate,
+                                     RCCId::kAPI_String_NewExternalFromUtf8);
+  if (resource->length() == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Unaccount(v8_isolate);
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  CHECK_NOT_NULL(resource->data());
+  const uint32_t length = static_cast<uint32_t>(resource->length());
+  if (i::String::IsAscii(resource->data(), length)) {
+    // ASCII is a subset of Latin-1, so the UTF-8 bytes can be used as is.
+    i::DirectHandle<i::String> string =
+        i_isolate->factory()
+            ->NewExternalStringFromOneByte(resource)
+            .ToHandleChecked();
+    return Utils::ToLocal(string);
+  }
+  // Decoding cannot fail, as the decoded string is never longer than the
+  // UTF-8 input.
+  i::DirectHandle<i::String> string =
+      i_isolate->factory()
+          ->NewStringFromUtf8(base::Vector<const char>(resource->data(), length))
+          .ToHandleChecked();
+  resource->Unaccount(v8_isolate);
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   v8::Isolate* isolate = v8::Isolate::GetCurrent();
   return MakeExternal(isolate, resource);
@@ -10760,6 +11192,16 @@ void Isolate::SetIsLoading(bool is_loading) {
   i_isolate->SetIsLoading(is_loading);
 }
 
+void Isolate::SetGCPauseBudget(double milliseconds) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!Utils::ApiCheck(milliseconds >= 0, "v8::Isolate::SetGCPauseBudget()",
+                       "Pause budget must not be negative")) {
+    return;
+  }
+  i_isolate->heap()->tracer()->SetPauseBudget(
+      base::TimeDelta::FromMillisecondsD(milliseconds));
+}
+
 void Isolate::Freeze(bool is_frozen) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->Freeze(is_frozen);
@@ -11676,6 +12118,10 @@ const char* CodeEvent::GetComment() {
   return reinterpret_cast<i::CodeEvent*>(this)->comment;
 }
 
+CodeEventTier CodeEvent::GetCodeTier() {
+  return reinterpret_cast<i::CodeEvent*>(this)->code_tier;
+}
+
 uintptr_t CodeEvent::GetPreviousCodeStartAddress() {
   return reinterpret_cast<i::CodeEvent*>(this)->previous_code_start_address;
 }
@@ -22,6 +22,7 @@
 // in that page.
 #include <errno.h>
 #include <fcntl.h>  // open
+#include <linux/mempolicy.h>
 #include <stdarg.h>
 #include <strings.h>   // index
 #include <sys/mman.h>  // mmap & munmap & mremap
@@ -277,6 +278,37 @@ std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   return ::v8::base::GetSharedLibraryAddresses(nullptr);
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  const uintptr_t start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kTransparentHugePageSize);
+  const uintptr_t end = RoundDown(reinterpret_cast<uintptr_t>(address) + size,
+                                  kTransparentHugePageSize);
+  if (end <= start) return false;
+  return madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) ==
+         0;
+}
+
+// static
+int OS::GetCurrentNumaNode() {
+  unsigned cpu;
+  unsigned node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+}
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int node) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  using NodeMask = unsigned long;  // NOLINT(runtime/int)
+  constexpr int kMaxNodes = sizeof(NodeMask) * 8;
+  if (node < 0 || node >= kMaxNodes) return false;
+  const NodeMask node_mask = NodeMask{1} << node;
+  // The kernel only considers the first |maxnode - 1| bits of the mask.
+  return syscall(SYS_mbind, address, size, MPOL_PREFERRED, &node_mask,
+                 kMaxNodes + 1, MPOL_MF_MOVE) == 0;
+}
+
 // static
 bool OS::RemapPages(const void* address, size_t size, void* new_address,
                     MemoryPermission access) {
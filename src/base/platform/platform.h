@@ -344,6 +344,39 @@ class V8_BASE_EXPORT OS {
 #endif
   }
 
+  static constexpr size_t kTransparentHugePageSize = size_t{2} << 20;
+
+  // Advises the kernel to back the kTransparentHugePageSize-aligned part of
+  // [address, address + size) with transparent huge pages. This is advisory
+  // only; pages are still allocated with the regular page size if huge pages
+  // are unavailable.
+  //
+  // Only defined on Linux, so callers must guard calls with V8_OS_LINUX.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address, size_t size);
+
+  // Whether the platform supports binding memory to NUMA nodes.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsNumaBindingSupported() {
+#if defined(V8_OS_LINUX)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Returns the NUMA node of the CPU the calling thread is running on, or -1
+  // if it cannot be determined.
+  static int GetCurrentNumaNode();
+
+  // Sets the preferred NUMA node of the pages in [address, address + size) to
+  // |node| and migrates pages that are already populated on other nodes.
+  // |address| must be page-aligned.
+  //
+  // Must not be called if |IsNumaBindingSupported()| return false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool BindMemoryToNumaNode(void* address,
+                                                         size_t size, int node);
+
   // Remaps already-mapped memory at |new_address| with |access| permissions.
   //
   // Both the source and target addresses must be page-aligned, and |size| must
@@ -373,6 +406,8 @@ class V8_BASE_EXPORT OS {
   friend class v8::base::VirtualAddressSpace;
   friend class v8::base::VirtualAddressSubspace;
   FRIEND_TEST(OS, RemapPages);
+  FRIEND_TEST(OS, AdviseHugePages);
+  FRIEND_TEST(OS, BindMemoryToNumaNode);
 
   static size_t AllocatePageSize();
 
@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "src/base/fpu.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -132,16 +133,27 @@ class BaselineBatchCompilerJob {
     handles_ = local_isolate->heap()->DetachPersistentHandles();
   }
 
-  // Executed in the main thread.
-  void Install(Isolate* isolate) {
+  // Executed in the main thread. Installs tasks until |timer| exceeds
+  // |budget| (if non-zero) and returns whether all tasks were installed. The
+  // budget is checked before every task except the first one installed in
+  // this interrupt (|*installed_any| is still false), so every interrupt makes
+  // progress.
+  bool Install(Isolate* isolate, const base::ElapsedTimer& timer,
+               base::TimeDelta budget, bool* installed_any) {
     HandleScope local_scope(isolate);
-    for (auto& task : tasks_) {
-      task.Install(isolate);
+    while (next_task_to_install_ < tasks_.size()) {
+      if (*installed_any && !budget.IsZero() && timer.Elapsed() >= budget) {
+        return false;
+      }
+      tasks_[next_task_to_install_++].Install(isolate);
+      *installed_any = true;
     }
+    return true;
   }
 
  private:
   std::vector<BaselineCompilerTask> tasks_;
+  size_t next_task_to_install_ = 0;
   std::unique_ptr<PersistentHandles> handles_;
 };
 
@@ -218,16 +230,31 @@ class ConcurrentBaselineCompiler {
   }
 
   void InstallBatch() {
-    while (!outgoing_queue_.IsEmpty()) {
-      std::unique_ptr<BaselineBatchCompilerJob> job;
-      outgoing_queue_.Dequeue(&job);
-      job->Install(isolate_);
+    // Installing is cheap per function, but a burst of compiled batches (e.g.
+    // during startup) could still block the main thread for a noticeable
+    // time. Spread it over several interrupts instead.
+    const base::TimeDelta budget = base::TimeDelta::FromMicroseconds(
+        v8_flags.concurrent_sparkplug_install_budget_us);
+    base::ElapsedTimer timer;
+    timer.Start();
+    bool installed_any = false;
+    while (partially_installed_job_ || !outgoing_queue_.IsEmpty()) {
+      std::unique_ptr<BaselineBatchCompilerJob> job =
+          std::move(partially_installed_job_);
+      if (!job) outgoing_queue_.Dequeue(&job);
+      if (!job->Install(isolate_, timer, budget, &installed_any)) {
+        partially_installed_job_ = std::move(job);
+        isolate_->stack_guard()->RequestInstallBaselineCode();
+        return;
+      }
     }
   }
 
  private:
   Isolate* isolate_;
   std::unique_ptr<JobHandle> job_handle_ = nullptr;
+  // Only accessed on the main thread.
+  std::unique_ptr<BaselineBatchCompilerJob> partially_installed_job_;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> incoming_queue_;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> outgoing_queue_;
 };
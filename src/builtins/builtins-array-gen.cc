@@ -19,6 +19,8 @@
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
 #include "src/heap/factory-inl.h"
+#include "src/interpreter/bytecode-register.h"
+#include "src/interpreter/bytecodes.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/arguments-inl.h"
 #include "src/objects/elements-kind.h"
@@ -37,6 +39,70 @@ ArrayBuiltinsAssembler::ArrayBuiltinsAssembler(
       a_(this),
       fully_spec_compliant_(this, {&k_, &a_}) {}
 
+TNode<BoolT> ArrayBuiltinsAssembler::IsNumericSortComparator(
+    TNode<JSFunction> comparefn) {
+  // Both comparators compile to Ldar <reg>; Sub <reg>, [slot]; Return with
+  // byte-sized operands. Sub computes <reg> - <accumulator>.
+  static constexpr int kLdarOffset = 0;
+  static constexpr int kSubOffset = 2;
+  static constexpr int kReturnOffset = 5;
+  static constexpr int kBytecodeLength = 6;
+  const uint8_t first_parameter = static_cast<uint8_t>(
+      interpreter::Register::FromParameterIndex(1).ToOperand());
+  const uint8_t second_parameter = static_cast<uint8_t>(
+      interpreter::Register::FromParameterIndex(2).ToOperand());
+  // The Ldar and Sub register operands, combined as (ldar << 8) | sub.
+  const int ascending_operands = (second_parameter << 8) | first_parameter;
+  const int descending_operands = (first_parameter << 8) | second_parameter;
+
+  TVARIABLE(BoolT, var_result, BoolConstant(false));
+  TVARIABLE(Object, var_data);
+  Label has_bytecode(this), match(this), done(this);
+  TNode<SharedFunctionInfo> shared = LoadObjectField<SharedFunctionInfo>(
+      comparefn, JSFunction::kSharedFunctionInfoOffset);
+  LoadSharedFunctionInfoTrustedDataAndDispatch(
+      shared, &var_data, nullptr, &done, &done,
+      {{BYTECODE_ARRAY_TYPE, &has_bytecode},
+       {INTERPRETER_DATA_TYPE, &has_bytecode},
+       {CODE_TYPE, &has_bytecode}});
+
+  BIND(&has_bytecode);
+  {
+    TNode<BytecodeArray> bytecode = LoadSharedFunctionInfoBytecodeArray(shared);
+    auto byte_at = [&](int offset) {
+      return LoadObjectField<Uint8T>(bytecode,
+                                     BytecodeArray::kHeaderSize + offset);
+    };
+    auto is_bytecode_at = [&](int offset, interpreter::Bytecode expected) {
+      return Word32Equal(byte_at(offset),
+                         Int32Constant(static_cast<uint8_t>(expected)));
+    };
+    GotoIfNot(Word32Equal(LoadAndUntagBytecodeArrayLength(bytecode),
+                          Int32Constant(kBytecodeLength)),
+              &done);
+    GotoIfNot(is_bytecode_at(kLdarOffset, interpreter::Bytecode::kLdar),
+              &done);
+    GotoIfNot(is_bytecode_at(kSubOffset, interpreter::Bytecode::kSub), &done);
+    GotoIfNot(is_bytecode_at(kReturnOffset, interpreter::Bytecode::kReturn),
+              &done);
+    TNode<Word32T> operands =
+        Word32Or(Word32Shl(byte_at(kLdarOffset + 1), Int32Constant(8)),
+                 byte_at(kSubOffset + 1));
+    GotoIf(Word32Equal(operands, Int32Constant(ascending_operands)), &match);
+    Branch(Word32Equal(operands, Int32Constant(descending_operands)), &match,
+           &done);
+  }
+
+  BIND(&match);
+  {
+    var_result = BoolConstant(true);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return var_result.value();
+}
+
 void ArrayBuiltinsAssembler::TypedArrayMapResultGenerator() {
   // 6. Let A be ? TypedArraySpeciesCreate(O, len).
   TNode<JSTypedArray> original_array = CAST(o());
@@ -25,6 +25,12 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
 
   void TypedArrayMapResultGenerator();
 
+  // Returns whether the bytecode of {comparefn} is exactly that of
+  // (a, b) => a - b or (a, b) => b - a, i.e. whether Array.prototype.sort may
+  // sort numbers without calling it. Runtime::kArraySortNumeric still checks
+  // the parameter count and whether the calls would be observable.
+  TNode<BoolT> IsNumericSortComparator(TNode<JSFunction> comparefn);
+
   // See tc39.github.io/ecma262/#sec-%typedarray%.prototype.map.
   TNode<JSAny> TypedArrayMapProcessor(TNode<Object> k_value, TNode<UintPtrT> k);
 
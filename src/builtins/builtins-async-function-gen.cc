@@ -126,6 +126,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   Return(async_function_object);
 }
@@ -204,9 +210,43 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait() {
 
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
+
+  // The await closures only refer to the {async_function_object}, so they are
+  // created on the first await and cached for all subsequent ones.
+  TVARIABLE(JSFunction, var_on_resolve);
+  TVARIABLE(JSFunction, var_on_reject);
+  Label if_closures_created(this), if_no_closures(this);
+  const TNode<Object> cached_on_resolve = LoadObjectField(
+      async_function_object, JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+  GotoIf(IsUndefined(cached_on_resolve), &if_no_closures);
+  var_on_resolve = CAST(cached_on_resolve);
+  var_on_reject = LoadObjectField<JSFunction>(
+      async_function_object, JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+  Goto(&if_closures_created);
+
+  BIND(&if_no_closures);
+  {
+    const TNode<NativeContext> native_context = LoadNativeContext(context);
+    const TNode<Context> closure_context =
+        AllocateAwaitContext(native_context, async_function_object);
+    var_on_resolve = AllocateRootFunctionWithContext(
+        RootIndex::kAsyncFunctionAwaitResolveClosureSharedFun, closure_context,
+        native_context);
+    var_on_reject = AllocateRootFunctionWithContext(
+        RootIndex::kAsyncFunctionAwaitRejectClosureSharedFun, closure_context,
+        native_context);
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     var_on_resolve.value());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     var_on_reject.value());
+    Goto(&if_closures_created);
+  }
+
+  BIND(&if_closures_created);
   Await(context, async_function_object, value, outer_promise,
-        RootIndex::kAsyncFunctionAwaitResolveClosureSharedFun,
-        RootIndex::kAsyncFunctionAwaitRejectClosureSharedFun);
+        var_on_resolve.value(), var_on_reject.value());
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
@@ -46,6 +46,47 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<JSAny> value, TNode<JSPromise> outer_promise,
     const CreateClosures& CreateClosures) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
+  const TNode<Context> closure_context =
+      AllocateAwaitContext(native_context, generator);
+
+  // Allocate and initialize resolve and reject handlers
+  auto [on_resolve, on_reject] =
+      CreateClosures(closure_context, native_context);
+  return Await(context, generator, value, outer_promise, on_resolve,
+               on_reject);
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitContext(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator) {
+  static const int kClosureContextSize =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  TNode<Context> closure_context =
+      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  {
+    // Initialize the await context, storing the {generator} as extension.
+    TNode<Map> map = CAST(LoadContextElementNoCell(
+        native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+    StoreMapNoWriteBarrier(closure_context, map);
+    StoreObjectFieldNoWriteBarrier(
+        closure_context, Context::kLengthOffset,
+        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+    const TNode<Object> empty_scope_info =
+        LoadContextElementNoCell(native_context, Context::SCOPE_INFO_INDEX);
+    StoreContextElementNoWriteBarrier(
+        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                      native_context);
+    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                      generator);
+  }
+  return closure_context;
+}
+
+TNode<Object> AsyncBuiltinsAssembler::Await(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<JSAny> value, TNode<JSPromise> outer_promise,
+    TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
@@ -99,32 +140,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     value = var_value.value();
   }
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(LoadContextElementNoCell(
-        native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElementNoCell(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
-
-  // Allocate and initialize resolve and reject handlers
-  auto [on_resolve, on_reject] =
-      CreateClosures(closure_context, native_context);
-
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
   // case of PromiseHooks or debugging.
@@ -32,6 +32,15 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                       TNode<JSGeneratorObject> generator, TNode<JSAny> value,
                       TNode<JSPromise> outer_promise, RootIndex on_resolve_sfi,
                       RootIndex on_reject_sfi);
+  TNode<Object> Await(TNode<Context> context,
+                      TNode<JSGeneratorObject> generator, TNode<JSAny> value,
+                      TNode<JSPromise> outer_promise,
+                      TNode<JSFunction> on_resolve,
+                      TNode<JSFunction> on_reject);
+
+  // Allocate the context of the closures resuming {generator} after an await.
+  TNode<Context> AllocateAwaitContext(TNode<NativeContext> native_context,
+                                      TNode<JSGeneratorObject> generator);
 
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
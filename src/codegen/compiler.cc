@@ -1066,6 +1066,15 @@ bool PrepareJobWithHandleScope(OptimizedCompilationJob* job, Isolate* isolate,
   return job->PrepareJob(isolate) == CompilationJob::SUCCEEDED;
 }
 
+// Returns true if the zone memory currently allocated for the isolate, which
+// includes all running compilation jobs, exceeds the budget for starting new
+// concurrent optimization jobs.
+bool CompilerZoneMemoryBudgetExceeded(Isolate* isolate) {
+  if (v8_flags.concurrent_compilation_zone_budget_mb == 0) return false;
+  return isolate->allocator()->GetCurrentMemoryUsage() >
+         size_t{v8_flags.concurrent_compilation_zone_budget_mb} * MB;
+}
+
 bool CompileTurbofan_NotConcurrent(Isolate* isolate,
                                    TurbofanCompilationJob* job) {
   OptimizedCompilationInfo* const compilation_info = job->compilation_info();
@@ -1136,6 +1145,16 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
     return false;
   }
 
+  if (CompilerZoneMemoryBudgetExceeded(isolate)) {
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Compiler zone memory budget exhausted, will retry "
+             "optimizing ");
+      ShortPrint(*function);
+      PrintF(" later.\n");
+    }
+    return false;
+  }
+
   TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
   RCS_SCOPE(isolate, RuntimeCallCounterId::kOptimizeConcurrentPrepare);
   TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -1152,6 +1171,16 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
                                    compilation_info->osr_offset());
   }
 
+  if (v8_flags.concurrent_recompilation_hotness_order) {
+    // OSR requests come from a function that is stuck in a hot loop, so they
+    // go before any regular request.
+    if (compilation_info->is_osr()) {
+      job->set_priority(kMaxInt);
+    } else if (function->has_feedback_vector()) {
+      job->set_priority(function->feedback_vector()->invocation_count());
+    }
+  }
+
   // The background recompile will own this job.
   if (!isolate->optimizing_compile_dispatcher()->TryQueueForOptimization(job)) {
     function->SetTieringInProgress(isolate, false,
@@ -1278,14 +1307,20 @@ MaybeHandle<Code> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
   // - aborts on memory pressure,
   // ...
 
-  // Prepare the job.
-  auto job = maglev::MaglevCompilationJob::New(isolate, function, osr_offset);
-
   if (IsConcurrent(mode) &&
       !isolate->maglev_concurrent_dispatcher()->is_enabled()) {
     mode = ConcurrencyMode::kSynchronous;
   }
 
+  // Don't add to the peak compiler memory when the budget is exhausted; the
+  // function will request tier-up again later.
+  if (IsConcurrent(mode) && CompilerZoneMemoryBudgetExceeded(isolate)) {
+    return {};
+  }
+
+  // Prepare the job.
+  auto job = maglev::MaglevCompilationJob::New(isolate, function, osr_offset);
+
   {
     TRACE_EVENT_WITH_FLOW0(
         TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -1680,8 +1715,12 @@ BackgroundCompileTask::BackgroundCompileTask(
           REPLMode::kNo, type,
           (options & ScriptCompiler::CompileOptions::kEagerCompile) == 0 &&
               v8_flags.lazy_streaming)),
-      character_stream_(ScannerStream::For(streamed_data->source_stream.get(),
-                                           streamed_data->encoding)),
+      character_stream_(
+          streamed_data->character_stream
+              ? std::move(streamed_data->character_stream)
+              : std::unique_ptr<Utf16CharacterStream>(ScannerStream::For(
+                    streamed_data->source_stream.get(),
+                    streamed_data->encoding))),
       stack_size_(v8_flags.stack_size),
       worker_thread_runtime_call_stats_(
           isolate->counters()->worker_thread_runtime_call_stats()),
@@ -1690,8 +1729,12 @@ BackgroundCompileTask::BackgroundCompileTask(
       start_position_(0),
       end_position_(0),
       function_literal_id_(kFunctionLiteralIdTopLevel),
+      trace_id_(GetNextTraceId() ^ reinterpret_cast<uintptr_t>(this)),
       compile_hint_callback_(compile_hint_callback),
       compile_hint_callback_data_(compile_hint_callback_data) {
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.CompileCodeBackgroundPrepare", trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_OUT);
   if (options & ScriptCompiler::CompileOptions::kProduceCompileHints) {
     flags_.set_produce_compile_hints(true);
   }
@@ -1728,7 +1771,11 @@ BackgroundCompileTask::BackgroundCompileTask(
       compilation_details_(nullptr),
       start_position_(shared_info->StartPosition()),
       end_position_(shared_info->EndPosition()),
-      function_literal_id_(shared_info->function_literal_id(kRelaxedLoad)) {
+      function_literal_id_(shared_info->function_literal_id(kRelaxedLoad)),
+      trace_id_(GetNextTraceId() ^ reinterpret_cast<uintptr_t>(this)) {
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.CompileCodeBackgroundPrepare", trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_OUT);
   DCHECK(!shared_info->is_toplevel());
   DCHECK(!is_streaming_compilation());
 
@@ -2013,8 +2060,9 @@ void BackgroundCompileTask::Run(
                            end_position_, function_literal_id_);
   parser.UpdateStatistics(script_, &use_counts_, &total_preparse_skipped_);
 
-  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
-               "V8.CompileCodeBackground");
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.CompileCodeBackground", trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
   RCS_SCOPE(isolate, RuntimeCallCounterIdForCompile(&info),
             RuntimeCallStats::CounterMode::kThreadSpecific);
 
@@ -2600,6 +2648,9 @@ MaybeHandle<SharedFunctionInfo> BackgroundCompileTask::FinalizeScript(
     Isolate* isolate, DirectHandle<String> source,
     const ScriptDetails& script_details,
     MaybeDirectHandle<Script> maybe_cached_script) {
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.CompileCodeBackgroundFinalize", trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_IN);
   ScriptOriginOptions origin_options = script_details.origin_options;
 
   DCHECK(flags_.is_toplevel());
@@ -2666,6 +2717,9 @@ MaybeHandle<SharedFunctionInfo> BackgroundCompileTask::FinalizeScript(
 
 bool BackgroundCompileTask::FinalizeFunction(
     Isolate* isolate, Compiler::ClearExceptionFlag flag) {
+  TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.CompileCodeBackgroundFinalize", trace_id_,
+                         TRACE_EVENT_FLAG_FLOW_IN);
   DCHECK(!flags_.is_toplevel());
 
   MaybeDirectHandle<SharedFunctionInfo> maybe_result;
@@ -493,12 +493,19 @@ class TurbofanCompilationJob : public OptimizedCompilationJob {
 
   Isolate* isolate() const { return isolate_; }
 
+  // Jobs with a higher priority are taken out of the input queue of the
+  // OptimizingCompileDispatcher first. Jobs with the same priority are
+  // compiled in the order in which they were queued.
+  int priority() const { return priority_; }
+  void set_priority(int priority) { priority_ = priority; }
+
   void Cancel();
 
  private:
   Isolate* const isolate_;
   OptimizedCompilationInfo* const compilation_info_;
   uint64_t trace_id_;
+  int priority_ = 0;
 };
 
 class FinalizeUnoptimizedCompilationData {
@@ -658,6 +665,10 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   int end_position_;
   int function_literal_id_;
 
+  // Links the main-thread creation and finalization of the task to the
+  // background work in traces.
+  uint64_t trace_id_;
+
   CompileHintCallback compile_hint_callback_ = nullptr;
   void* compile_hint_callback_data_ = nullptr;
 };
@@ -678,6 +689,10 @@ struct V8_EXPORT_PRIVATE ScriptStreamingData {
   std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream;
   ScriptCompiler::StreamedSource::Encoding encoding;
 
+  // Used instead of |source_stream| if the whole source is already available
+  // off-heap, e.g. as an external string (see ScriptCompiler::CompileBatch).
+  std::unique_ptr<Utf16CharacterStream> character_stream;
+
   // Task that performs background parsing and compilation.
   std::unique_ptr<BackgroundCompileTask> task;
 };
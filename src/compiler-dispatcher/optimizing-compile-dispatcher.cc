@@ -390,7 +390,22 @@ void OptimizingCompileInputQueue::Prioritize(
                      return *job->compilation_info()->shared_info() == function;
                    });
 
-  if (it != queue_.end()) {
+  if (it != queue_.end() && v8_flags.concurrent_recompilation_hotness_order) {
+    // The queue is sorted by priority (see Enqueue). Raise the job to the
+    // highest queued priority and re-insert it before all jobs with that
+    // priority, which keeps the queue sorted.
+    TurbofanCompilationJob* job = *it;
+    queue_.erase(it);
+    if (!queue_.empty()) {
+      job->set_priority(std::max(job->priority(), queue_.front()->priority()));
+    }
+    int priority = job->priority();
+    auto position = std::find_if(queue_.begin(), queue_.end(),
+                                 [priority](TurbofanCompilationJob* queued) {
+                                   return queued->priority() <= priority;
+                                 });
+    queue_.insert(position, job);
+  } else if (it != queue_.end()) {
     auto first_for_isolate = std::find_if(
         queue_.begin(), queue_.end(), [isolate](TurbofanCompilationJob* job) {
           return job->isolate() == isolate;
@@ -448,7 +463,14 @@ bool OptimizingCompileInputQueue::Enqueue(
     std::unique_ptr<TurbofanCompilationJob>& job) {
   base::MutexGuard access(&mutex_);
   if (queue_.size() < capacity_) {
-    queue_.push_back(job.release());
+    // Keep the queue sorted by priority. Jobs are inserted after all jobs
+    // with the same priority to retain FIFO order among them.
+    int priority = job->priority();
+    auto it = std::find_if(queue_.rbegin(), queue_.rend(),
+                           [priority](TurbofanCompilationJob* queued) {
+                             return queued->priority() >= priority;
+                           });
+    queue_.insert(it.base(), job.release());
     return true;
   } else {
     return false;
@@ -5963,10 +5963,11 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
     }
     case kX64I32x8DotI8x32I7x32AddS: {
       DCHECK_EQ(i.OutputSimd256Register(), i.InputSimd256Register(2));
-      // If AVX_VNNI supported, pass kScratchSimd256Reg twice as unused
-      // arguments.
+      // If AVX_VNNI or AVX_VNNI_INT8 supported, pass kScratchSimd256Reg twice
+      // as unused arguments.
       YMMRegister tmp = kScratchSimd256Reg;
-      if (!CpuFeatures::IsSupported(AVX_VNNI)) {
+      if (!(CpuFeatures::IsSupported(AVX_VNNI) ||
+            CpuFeatures::IsSupported(AVX_VNNI_INT8))) {
         tmp = i.TempSimd256Register(0);
       }
       __ I32x8DotI8x32I7x32AddS(
@@ -5941,7 +5941,8 @@ void InstructionSelector::VisitI32x4DotI8x16I7x16AddS(OpIndex node) {
   X64OperandGenerator g(this);
   const Simd128TernaryOp& op = Cast<Simd128TernaryOp>(node);
   DCHECK_EQ(op.input_count, 3);
-  if (CpuFeatures::IsSupported(AVX_VNNI)) {
+  if (CpuFeatures::IsSupported(AVX_VNNI) ||
+      CpuFeatures::IsSupported(AVX_VNNI_INT8)) {
     Emit(kX64I32x4DotI8x16I7x16AddS, g.DefineSameAsInput(node, 2),
          g.UseRegister(op.input(0)), g.UseRegister(op.input(1)),
          g.UseRegister(op.input(2)));
@@ -5966,7 +5967,8 @@ void InstructionSelector::VisitI32x8DotI8x32I7x32AddS(OpIndex node) {
   X64OperandGenerator g(this);
   const Simd256TernaryOp& op = Cast<Simd256TernaryOp>(node);
   DCHECK_EQ(op.input_count, 3);
-  if (CpuFeatures::IsSupported(AVX_VNNI)) {
+  if (CpuFeatures::IsSupported(AVX_VNNI) ||
+      CpuFeatures::IsSupported(AVX_VNNI_INT8)) {
     Emit(kX64I32x8DotI8x32I7x32AddS, g.DefineSameAsInput(node, 2),
          g.UseRegister(op.input(0)), g.UseRegister(op.input(1)),
          g.UseRegister(op.input(2)));
@@ -491,6 +491,18 @@ void LateLoadEliminationAnalyzer::ProcessCall(OpIndex op_idx,
         memory_.Invalidate(op.arguments()[0], OpIndex::Invalid(),
                            JSObject::kElementsOffset);
         return;
+      case Builtin::kGrowFastDoubleElements:
+      case Builtin::kGrowFastSmiOrObjectElements:
+        // These functions allocate a larger Elements array for an object
+        // without changing its elements kind (and thus its map). The old
+        // Elements array is left untouched, so only the Elements field of the
+        // object needs to be invalidated. This is important to keep the
+        // state in loops that push onto arrays.
+        TRACE(">> Call is GrowFastElements, invalidating only Elements for "
+              << op.arguments()[0]);
+        memory_.Invalidate(op.arguments()[0], OpIndex::Invalid(),
+                           JSObject::kElementsOffset);
+        return;
       default:
         break;
     }
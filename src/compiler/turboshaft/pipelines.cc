@@ -50,10 +50,26 @@ bool Pipeline::AllocateRegisters(const RegisterConfiguration* config,
 
   data_->InitializeRegisterComponent(config, call_descriptor);
 
+  // For very large (typically machine-generated) functions, skip the two
+  // phases that only improve the quality of the allocation. The linear scan
+  // itself still runs as usual.
+  const bool skip_optimizations =
+      v8_flags.turbo_regalloc_skip_optimizations_threshold > 0 &&
+      data_->sequence()->instructions().size() >
+          v8_flags.turbo_regalloc_skip_optimizations_threshold;
+  if (skip_optimizations && v8_flags.trace_turbo_alloc) {
+    PrintF(
+        "Skipping live range bundling and move optimization for %zu "
+        "instructions\n",
+        data_->sequence()->instructions().size());
+  }
+
   RUN_MAYBE_ABORT(MeetRegisterConstraintsPhase);
   RUN_MAYBE_ABORT(ResolvePhisPhase);
   RUN_MAYBE_ABORT(BuildLiveRangesPhase);
-  RUN_MAYBE_ABORT(BuildLiveRangeBundlesPhase);
+  if (!skip_optimizations) {
+    RUN_MAYBE_ABORT(BuildLiveRangeBundlesPhase);
+  }
 
   TraceSequence("before register allocation");
   if (verifier != nullptr) {
@@ -96,7 +112,7 @@ bool Pipeline::AllocateRegisters(const RegisterConfiguration* config,
 
   RUN_MAYBE_ABORT(PopulateReferenceMapsPhase);
 
-  if (v8_flags.turbo_move_optimization) {
+  if (v8_flags.turbo_move_optimization && !skip_optimizations) {
     RUN_MAYBE_ABORT(OptimizeMovesPhase);
   }
 
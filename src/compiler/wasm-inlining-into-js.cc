@@ -289,8 +289,9 @@ class WasmIntoJSInlinerImpl : private wasm::Decoder {
     Node* cast = gasm_.WasmTypeCast(
         input.node, rtt,
         {input.type, target_type,
-         module_->type(target_type_index).is_final ? kExactMatchOnly
-                                                   : kMayBeSubtype});
+         module_->type(target_type_index).is_effectively_final()
+             ? kExactMatchOnly
+             : kMayBeSubtype});
     SetSourcePosition(cast);
     return TypeNode(cast, target_type);
   }
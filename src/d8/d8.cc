@@ -6576,7 +6576,9 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    serializer_.SetShareLargeStrings(true);
+  }
 
   Serializer(const Serializer&) = delete;
   Serializer& operator=(const Serializer&) = delete;
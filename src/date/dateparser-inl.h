@@ -16,6 +16,8 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
+  if (TryParseISODateTimeFast(str, out)) return true;
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -180,6 +182,51 @@ bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
   return success;
 }
 
+template <typename Char>
+bool DateParser::TryParseISODateTimeFast(base::Vector<Char> str,
+                                         double* out) {
+  // YYYY-MM-DDTHH:mm:ss.sssZ
+  static constexpr char kPattern[] = "0000-00-00T00:00:00.000Z";
+  static constexpr int kLength = arraysize(kPattern) - 1;
+  if (str.length() != kLength) return false;
+  for (int i = 0; i < kLength; i++) {
+    if (kPattern[i] == '0') {
+      if (!IsDecimalDigit(str[i])) return false;
+    } else if (str[i] != kPattern[i]) {
+      return false;
+    }
+  }
+  auto read = [&](int start, int length) {
+    int value = 0;
+    for (int i = start; i < start + length; i++) {
+      value = value * 10 + (str[i] - '0');
+    }
+    return value;
+  };
+  int year = read(0, 4);
+  int month = read(5, 2);
+  int day = read(8, 2);
+  int hour = read(11, 2);
+  int minute = read(14, 2);
+  int second = read(17, 2);
+  int millisecond = read(20, 3);
+  // Hour 24 is left to the general parser.
+  if (!Between(month, 1, 12) || !Between(day, 1, 31) ||
+      !Between(hour, 0, 23) || !Between(minute, 0, 59) ||
+      !Between(second, 0, 59)) {
+    return false;
+  }
+  out[YEAR] = year;
+  out[MONTH] = month - 1;  // 0-based
+  out[DAY] = day;
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  out[SECOND] = second;
+  out[MILLISECOND] = millisecond;
+  out[UTC_OFFSET] = 0;
+  return true;
+}
+
 template <typename CharType>
 DateParser::DateToken DateParser::DateStringTokenizer<CharType>::Scan() {
   int pre_pos = in_->position();
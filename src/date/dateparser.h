@@ -360,6 +360,13 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Parses the exact "YYYY-MM-DDTHH:mm:ss.sssZ" format produced by
+  // Date.prototype.toISOString without going through the tokenizer. Returns
+  // false if the string does not have that format or any component is out of
+  // the range handled here, in which case the general parser has to be used.
+  template <typename Char>
+  static bool TryParseISODateTimeFast(base::Vector<Char> str, double* output);
 };
 
 }  // namespace internal
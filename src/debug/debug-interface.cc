@@ -17,6 +17,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-generator-inl.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/strings/string-builder-inl.h"
@@ -1006,6 +1007,66 @@ void GetLoadedScripts(Isolate* v8_isolate,
   }
 }
 
+namespace {
+
+bool IsSummarizedICKind(i::FeedbackSlotKind kind) {
+  return i::IsCallICKind(kind) || i::IsLoadICKind(kind) ||
+         i::IsKeyedLoadICKind(kind) || i::IsKeyedHasICKind(kind) ||
+         i::IsSetNamedICKind(kind) || i::IsDefineNamedOwnICKind(kind) ||
+         i::IsKeyedStoreICKind(kind) || i::IsDefineKeyedOwnICKind(kind);
+}
+
+}  // namespace
+
+std::vector<ICFeedbackSummary> CollectICFeedbackSummaries(
+    Isolate* v8_isolate) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnterV8NoScriptNoExceptionScope api_scope(isolate);
+  std::vector<ICFeedbackSummary> summaries;
+  i::HeapObjectIterator heap_iterator(isolate->heap());
+  i::DisallowGarbageCollection no_gc;
+  for (i::Tagged<i::HeapObject> obj = heap_iterator.Next(); !obj.is_null();
+       obj = heap_iterator.Next()) {
+    if (!i::IsFeedbackVector(obj)) continue;
+    i::Tagged<i::FeedbackVector> vector = i::Cast<i::FeedbackVector>(obj);
+    i::Tagged<i::SharedFunctionInfo> shared = vector->shared_function_info();
+    if (!shared->IsSubjectToDebugging()) continue;
+
+    ICFeedbackSummary summary = {};
+    i::FeedbackMetadataIterator it(vector->metadata(), no_gc);
+    while (it.HasNext()) {
+      i::FeedbackSlot slot = it.Next();
+      if (!IsSummarizedICKind(it.kind())) continue;
+      switch (i::FeedbackNexus(isolate, vector, slot).ic_state()) {
+        case i::InlineCacheState::MONOMORPHIC:
+          summary.monomorphic_sites++;
+          break;
+        case i::InlineCacheState::POLYMORPHIC:
+          summary.polymorphic_sites++;
+          break;
+        case i::InlineCacheState::MEGADOM:
+        case i::InlineCacheState::MEGAMORPHIC:
+        case i::InlineCacheState::GENERIC:
+          summary.megamorphic_sites++;
+          break;
+        default:
+          break;
+      }
+    }
+    if (summary.polymorphic_sites == 0 && summary.megamorphic_sites == 0) {
+      continue;
+    }
+    summary.script_id = i::IsScript(shared->script())
+                            ? i::Cast<i::Script>(shared->script())->id()
+                            : v8::UnboundScript::kNoScriptId;
+    summary.function_start_position = shared->StartPosition();
+    summary.invocation_count =
+        static_cast<uint32_t>(vector->invocation_count());
+    summaries.push_back(summary);
+  }
+  return summaries;
+}
+
 std::optional<v8::ScriptOrigin> GetScriptOrigin(Isolate* v8_isolate,
                                                 int script_id) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
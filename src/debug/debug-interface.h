@@ -291,6 +291,23 @@ void Disassemble(base::Vector<const uint8_t> wire_bytes,
 V8_EXPORT_PRIVATE void GetLoadedScripts(
     Isolate* isolate, std::vector<v8::Global<Script>>& scripts);
 
+// Summary of the inline cache states recorded in one feedback vector.
+struct ICFeedbackSummary {
+  int script_id;
+  int function_start_position;
+  uint32_t invocation_count;
+  int monomorphic_sites;
+  int polymorphic_sites;
+  int megamorphic_sites;
+};
+
+// Walks the heap and returns a summary for every feedback vector that has at
+// least one polymorphic or megamorphic property access or call site. Only
+// property access and call ICs are counted. Ranking the result by invocation
+// count points at the hottest code that runs on generic dispatch.
+V8_EXPORT_PRIVATE std::vector<ICFeedbackSummary> CollectICFeedbackSummaries(
+    Isolate* isolate);
+
 V8_EXPORT_PRIVATE std::optional<v8::ScriptOrigin> GetScriptOrigin(
     Isolate* v8_isolate, int script_id);
 
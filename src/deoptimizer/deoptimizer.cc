@@ -26,7 +26,10 @@
 #include "src/objects/deoptimization-data.h"
 #include "src/objects/js-function-inl.h"
 #include "src/objects/oddball.h"
+#include "src/objects/script-inl.h"
 #include "src/snapshot/embedded/embedded-data.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
 #include "src/utils/utils.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -849,6 +852,32 @@ void Deoptimizer::TraceDeoptBegin(int optimization_id,
   }
 }
 
+void Deoptimizer::TraceDeoptEvent(int optimization_id,
+                                  BytecodeOffset bytecode_offset) {
+  bool enabled = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.deopt"),
+                                     &enabled);
+  if (V8_LIKELY(!enabled)) return;
+
+  Deoptimizer::DeoptInfo info = Deoptimizer::GetDeoptInfo();
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("kind", MessageFor(deopt_kind_));
+  value->SetString("reason", DeoptimizeReasonToString(info.deopt_reason));
+  value->SetString("codeKind", CodeKindToString(compiled_code_->kind()));
+  value->SetInteger("optimizationId", optimization_id);
+  value->SetInteger("bytecodeOffset", bytecode_offset.ToInt());
+  if (IsJSFunction(function_)) {
+    Tagged<SharedFunctionInfo> shared = function_->shared();
+    value->SetString("functionName", shared->DebugNameCStr().get());
+    value->SetInteger("scriptId", IsScript(shared->script())
+                                      ? Cast<Script>(shared->script())->id()
+                                      : -1);
+    value->SetInteger("functionPosition", shared->StartPosition());
+  }
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.deopt"), "V8.Deoptimize",
+                       TRACE_EVENT_SCOPE_THREAD, "data", std::move(value));
+}
+
 void Deoptimizer::TraceDeoptEnd(double deopt_duration) {
   DCHECK(verbose_tracing_enabled());
   PrintF(trace_scope()->file(), "[bailout end. took %0.3f ms]\n",
@@ -1553,6 +1582,7 @@ void Deoptimizer::DoComputeOutputFrames() {
     timer.Start();
     TraceDeoptBegin(input_data->OptimizationId().value(), bytecode_offset);
   }
+  TraceDeoptEvent(input_data->OptimizationId().value(), bytecode_offset);
 
   FILE* trace_file =
       verbose_tracing_enabled() ? trace_scope()->file() : nullptr;
@@ -1882,6 +1882,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return &startup_object_cache_;
   }
 
+  // Decompressed context snapshot data, see
+  // --cache-decompressed-context-snapshots. Returns an empty vector if the
+  // snapshot at |index| has not been decompressed yet.
+  base::Vector<const uint8_t> decompressed_context_snapshot(
+      size_t index) const {
+    if (index >= decompressed_context_snapshots_.size()) return {};
+    return decompressed_context_snapshots_[index].as_vector();
+  }
+  void set_decompressed_context_snapshot(size_t index,
+                                         base::OwnedVector<uint8_t> data) {
+    if (index >= decompressed_context_snapshots_.size()) {
+      decompressed_context_snapshots_.resize(index + 1);
+    }
+    decompressed_context_snapshots_[index] = std::move(data);
+  }
+
   // With a shared heap, this cache is shared among all isolates. Otherwise this
   // object cache is per-Isolate like the startup object cache. TODO(372493838):
   // This cache can only contain strings. Update name to reflect this.
@@ -2783,6 +2799,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::vector<Tagged<Object>> startup_object_cache_;
 
+  std::vector<base::OwnedVector<uint8_t>> decompressed_context_snapshots_;
+
   // When sharing data among Isolates (e.g. v8_flags.shared_string_table), only
   // the shared Isolate populates this and client Isolates reference that copy.
   //
@@ -384,7 +384,8 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
     }
   }
 
-  if (V8_UNLIKELY(isolate_->EfficiencyModeEnabled() &&
+  if (V8_UNLIKELY(v8_flags.efficiency_mode_synchronous_maglev &&
+                  isolate_->EfficiencyModeEnabled() &&
                   d.code_kind != CodeKind::TURBOFAN_JS)) {
     d.concurrency_mode = ConcurrencyMode::kSynchronous;
   }
@@ -779,6 +779,9 @@ DEFINE_BOOL(empty_context_extension_dep, true,
             "non-empty context extensions")
 
 DEFINE_BOOL(json_stringify_fast_path, true, "Enable JSON.stringify fast-path")
+DEFINE_SIZE_T(json_parse_pretenure_threshold, 1 * MB,
+              "allocate objects created by JSON.parse in old space if the "
+              "source is at least this many characters long (0 to disable)")
 
 // TODO(jgruber): Remove this flag.
 DEFINE_BOOL(cache_property_key_string_adds, true,
@@ -844,6 +847,9 @@ DEFINE_BOOL(efficiency_mode_disable_turbofan, false,
 DEFINE_INT(efficiency_mode_delay_turbofan_multiply, 3,
            "Delay tier-up to turbofan to a certain invocation count multipier "
            "while in efficiency mode.")
+DEFINE_BOOL(efficiency_mode_synchronous_maglev, true,
+            "Compile Maglev code, including OSR code, on the main thread while "
+            "in efficiency mode.")
 
 // Flag to select wasm trace mark type
 DEFINE_STRING(
@@ -1161,6 +1167,10 @@ DEFINE_UINT(
     "max number of threads that concurrent Sparkplug can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
+DEFINE_UINT(concurrent_sparkplug_install_budget_us, 500,
+            "max main thread time in microseconds spent installing "
+            "concurrently compiled Sparkplug code per interrupt (0 for "
+            "unbounded)")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
@@ -1183,6 +1193,9 @@ DEFINE_WEAK_IMPLICATION(trace_baseline, trace_baseline_batch_compilation)
 DEFINE_BOOL(shared_string_table, false, "internalize strings into shared table")
 DEFINE_IMPLICATION(harmony_struct, shared_string_table)
 DEFINE_IMPLICATION(shared_string_table, shared_heap)
+DEFINE_BOOL(trace_string_table_stats, false,
+            "print string table insertion and lock contention counts when "
+            "the table is destroyed")
 DEFINE_BOOL_READONLY(always_use_string_forwarding_table, false,
                      "use string forwarding table instead of thin strings for "
                      "all strings (experimental)")
@@ -1220,6 +1233,12 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
             "move compile jobs to the front if recompilation is requested "
             "multiple times")
+DEFINE_BOOL(concurrent_recompilation_hotness_order, false,
+            "compile queued jobs of hotter functions (by invocation count) "
+            "first instead of in request order")
+DEFINE_UINT(concurrent_compilation_zone_budget_mb, 0,
+            "don't start new concurrent Maglev or Turbofan jobs while the "
+            "isolate's zone memory exceeds this many MB (0 for no limit)")
 DEFINE_UINT(
     concurrent_turbofan_max_threads, 4,
     "max number of threads that concurrent Turbofan can use (0 for unbounded)")
@@ -1518,6 +1537,9 @@ DEFINE_STRING(
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_UINT(turbo_regalloc_skip_optimizations_threshold, 200000,
+            "skip live range bundling and gap move optimization for "
+            "functions with more instructions than this (0 to disable)")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
@@ -1715,6 +1737,10 @@ DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
            "invocation count for maglev for functions which according to "
            "profile_guided_optimization are likely to deoptimize before "
            "reaching this invocation count")
+DEFINE_BOOL(profile_guided_optimization_in_code_cache, false,
+            "keep profile guided tiering decisions (e.g. early Maglev or "
+            "Turbofan) in the code cache so that deserialized functions tier "
+            "up early")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1802,6 +1828,9 @@ DEFINE_BOOL(stress_wasm_stack_switching, false,
             "with a regular (non-JSPI) export")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_SIZE_T(wasm_stack_pool_size, 4096,
+              "maximum total size of finished wasm stacks kept for reuse by "
+              "new suspendable computations (in kB)")
 // 1 will be rounded up to the smallest possible initial stack size, which
 // depends on the stack limit margin and the platform's page size.
 DEFINE_VALUE_IMPLICATION(experimental_wasm_growable_stacks,
@@ -1814,6 +1843,12 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_keep_loop_invariant_locals, true,
+            "keep locals which are not assigned in a loop in registers when "
+            "entering the loop in Liftoff")
+DEFINE_BOOL(liftoff_inline_allocation, true,
+            "allocate Wasm GC structs and fixed-size arrays inline in Liftoff "
+            "code, calling a builtin only if the allocation area is exhausted")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1930,6 +1965,10 @@ DEFINE_EXPERIMENTAL_FEATURE(
     "skip null checks for call.ref and array and struct operations (unsafe)")
 DEFINE_EXPERIMENTAL_FEATURE(experimental_wasm_skip_bounds_checks,
                             "skip array bounds checks (unsafe)")
+DEFINE_EXPERIMENTAL_FEATURE(
+    experimental_wasm_closed_world,
+    "assume that no GC objects of other modules flow into a module, and treat "
+    "types without subtypes in the module as final (unsafe)")
 
 // Experimental variants of the Custom Descriptors prototype implementation.
 DEFINE_BOOL(wasm_explicit_prototypes, true,
@@ -2280,6 +2319,9 @@ DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_BOOL(incremental_marking_idle_tasks, false,
+            "additionally perform incremental marking steps in idle tasks if "
+            "the embedder supports them")
 DEFINE_BOOL(incremental_marking_start_user_visible, true,
             "Starts incremental marking with kUserVisible priority.")
 DEFINE_BOOL(incremental_marking_always_user_visible, false,
@@ -2295,6 +2337,11 @@ DEFINE_BOOL(incremental_marking_unified_schedule, false,
             "JS and C++ objects.")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_INT(scavenger_max_tasks, 8,
+           "maximum number of parallel scavenge tasks (capped at 64)")
+DEFINE_BOOL(scavenger_string_deduplication, false,
+            "deduplicate short sequential one-byte strings with equal "
+            "contents when the scavenger promotes them")
 DEFINE_BOOL(minor_gc_task, true, "schedule minor GC tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
             "minor GC task trigger in percent of the current heap limit")
@@ -2328,15 +2375,27 @@ DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
+DEFINE_BOOL(incremental_ephemeron_processing, false,
+            "retry unresolved ephemerons on concurrent marking threads during "
+            "incremental marking instead of only in the atomic pause")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
                            concurrent_array_buffer_sweeping)
+DEFINE_BOOL(parallel_major_sweeping, false,
+            "use more than one concurrent sweeper per space and let the main "
+            "thread join the sweeper job when finalizing major sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(marking_prefetch, false,
+            "pop objects from the marking worklist ahead of visiting them and "
+            "prefetch their headers")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_BOOL(parallel_pointer_table_sweeping, true,
+            "sweep the trusted and code pointer tables on a background thread "
+            "in the atomic pause.")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -2402,6 +2461,9 @@ DEFINE_BOOL_READONLY(verify_write_barriers, false,
 DEFINE_BOOL(safepoint_bump_qos_class, true,
             "Bump QOS class for running threads to reach safepoint")
 #endif
+DEFINE_BOOL(trace_global_safepoint, false,
+            "print how long each client isolate takes to reach a global "
+            "safepoint")
 DEFINE_BOOL(memory_reducer_respects_frozen_state, false,
             "don't schedule another GC when we are frozen")
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
@@ -2424,7 +2486,14 @@ DEFINE_BOOL(gc_speed_uses_counters, false,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(numa_local_pages, false,
+            "Prefer the NUMA node of the allocating thread for the memory of "
+            "newly allocated heap pages, migrating reused pooled pages there "
+            "(Linux only)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
+DEFINE_BOOL(adaptive_shared_space_labs, false,
+            "Grow the linear allocation areas that threads take from the "
+            "shared space free list with every refill")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
 DEFINE_BOOL(compact_code_space, true,
@@ -2433,11 +2502,19 @@ DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
+DEFINE_INT(compaction_pause_budget_ms, 0,
+           "Limit the bytes evacuated in a single latency-critical full GC to "
+           "what can be compacted in this many milliseconds at the traced "
+           "compaction speed, spreading compaction of fragmented pages over "
+           "several GCs (0 uses the fixed default limit)")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
             "Stress GC compaction to flush out bugs with moving objects")
 DEFINE_BOOL(resize_large_object, true, "Support resizing of large objects")
+DEFINE_BOOL(discard_trimmed_large_object_tails, false,
+            "Return the OS pages of large arrays that become unused by right "
+            "trimming right away instead of at the next full GC")
 DEFINE_BOOL(stress_compaction_random, false,
             "Stress GC compaction by selecting random percent of pages as "
             "evacuation candidates. Overrides stress_compaction.")
@@ -2454,6 +2531,9 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
+DEFINE_BOOL(flush_code_on_memory_pressure, false,
+            "flush all bytecode and baseline code regardless of age in GCs "
+            "triggered by memory pressure notifications")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_WEAK_IMPLICATION(stress_flush_code, flush_baseline_code)
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
@@ -2470,6 +2550,9 @@ DEFINE_BOOL(memory_pool, true,
 DEFINE_BOOL(
     memory_pool_share_memory_on_teardown, true,
     "Share memory on Isolate teardown using other Isolate's task runners")
+DEFINE_SIZE_T(memory_pool_retained_pages_on_last_teardown, 0,
+              "Number of pooled pages kept for the next Isolate when no other "
+              "Isolate is alive on teardown")
 DEFINE_BOOL(memory_pool_release_before_memory_pressure_gcs, true,
             "discard the memory pool before invoking the GC on memory pressure "
             "or last resort GCs")
@@ -2761,6 +2844,10 @@ DEFINE_BOOL(trace_file_names, false,
 DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_BOOL(code_cache_lazy_functions, false,
+            "omit the bytecode of inner functions that have not been executed "
+            "recently (see --bytecode-old-age) from code caches, so that they "
+            "are only compiled when first called after deserialization")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -3020,6 +3107,10 @@ DEFINE_BOOL(better_code_range_allocation,
 DEFINE_BOOL(abort_on_far_code_range, false,
             "Abort if code range is allocated further away than 4GB from the"
             ".text section")
+DEFINE_BOOL(huge_pages_for_code, false,
+            "Back the code range and the re-embedded builtins with transparent "
+            "huge pages where supported (Linux only). The embedded builtins "
+            "are then copied instead of remapped.")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -3041,6 +3132,12 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(cache_decompressed_context_snapshots, false,
+            "keep decompressed context snapshots alive for the lifetime of "
+            "the isolate instead of decompressing them for every new context "
+            "(only affects builds with snapshot compression)")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "decompress the blocks of compressed snapshots on worker threads")
 DEFINE_BOOL(trace_deserialization, false, "Trace the snapshot deserialization.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
@@ -3059,9 +3156,15 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_backtracks, 10000,
+           "tier up a regexp to the compiler once a single execution in the "
+           "interpreter exceeds this number of backtracks (0 to disable)")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(regexp_results_cache, true, "enable the regexp results cache")
+DEFINE_BOOL(regexp_shared_bytecode_cache, false,
+            "share compiled regexp bytecode between all isolates of the "
+            "process")
 DEFINE_EXPERIMENTAL_FEATURE(regexp_assemble_from_bytecode,
                             "assemble regexp JIT-code from bytecode")
 DEFINE_NEG_NEG_IMPLICATION(regexp_tier_up, regexp_assemble_from_bytecode)
@@ -3087,6 +3190,9 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "reject inputs without a match in the experimental regexp engine "
+            "using a lazily constructed DFA before running the NFA")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3700,6 +3806,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_table_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
@@ -313,6 +313,7 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
   Local(Local&& other) V8_NOEXCEPT : worklist_(other.worklist_) {
     std::swap(push_segment_, other.push_segment_);
     std::swap(pop_segment_, other.pop_segment_);
+    std::swap(segments_taken_from_global_, other.segments_taken_from_global_);
   }
   Local& operator=(Local&&) V8_NOEXCEPT = delete;
 
@@ -329,6 +330,10 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
 
   size_t PushSegmentSize() const { return push_segment_->Size(); }
 
+  // Number of segments that Pop() took from the global worklist after running
+  // out of local entries.
+  size_t SegmentsTakenFromGlobal() const { return segments_taken_from_global_; }
+
   void Publish();
 
   void Merge(Worklist<EntryType, MinSegmentSize>::Local& other);
@@ -372,6 +377,7 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
   Worklist<EntryType, MinSegmentSize>& worklist_;
   internal::SegmentBase* push_segment_ = nullptr;
   internal::SegmentBase* pop_segment_ = nullptr;
+  size_t segments_taken_from_global_ = 0;
 };
 
 template <typename EntryType, uint16_t MinSegmentSize>
@@ -463,6 +469,7 @@ bool Worklist<EntryType, MinSegmentSize>::Local::StealPopSegment() {
   if (worklist_.Pop(&new_segment)) {
     DeleteSegment(pop_segment_);
     pop_segment_ = new_segment;
+    segments_taken_from_global_++;
     return true;
   }
   return false;
@@ -195,6 +195,14 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
       base(), size(), PagePermissions::kNoAccess);
 #endif  // V8_ENABLE_SANDBOX_HARDWARE_SUPPORT
 
+#if V8_OS_LINUX
+  if (v8_flags.huge_pages_for_code && !v8_flags.jitless) {
+    // Code pages are allocated in this region later on, so the kernel can
+    // collapse adjacent code pages into huge pages. This is advisory only.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(base()), size()));
+  }
+#endif  // V8_OS_LINUX
+
   // On some platforms, specifically Win64, we need to reserve some pages at
   // the beginning of an executable space. See
   //   https://cs.chromium.org/chromium/src/components/crash/content/
@@ -434,20 +442,45 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
 
   const size_t kAllocatePageSize = page_allocator()->AllocatePageSize();
   const size_t kCommitPageSize = page_allocator()->CommitPageSize();
-  size_t allocate_code_size =
-      RoundUp(embedded_blob_code_size, kAllocatePageSize);
+  // Huge pages require the copy to be aligned to and padded to whole huge
+  // pages.
+#if V8_OS_LINUX
+  bool use_huge_pages =
+      v8_flags.huge_pages_for_code &&
+      IsAligned(base::OS::kTransparentHugePageSize, kAllocatePageSize);
+#else
+  bool use_huge_pages = false;
+#endif  // V8_OS_LINUX
 
   // Allocate the re-embedded code blob in such a way that it will be reachable
   // by PC-relative addressing from biggest possible region.
   const size_t max_pc_relative_code_range = kMaxPCRelativeCodeRangeInMB * MB;
-  size_t hint_offset =
-      std::min(max_pc_relative_code_range, code_region.size()) -
-      allocate_code_size;
-  void* hint = reinterpret_cast<void*>(code_region.begin() + hint_offset);
+  const Address code_region_limit =
+      code_region.begin() +
+      std::min(max_pc_relative_code_range, code_region.size());
+  size_t allocate_code_size =
+      RoundUp(embedded_blob_code_size, kAllocatePageSize);
+  Address hint_address = code_region_limit - allocate_code_size;
+  if (use_huge_pages) {
+    const size_t huge_code_size =
+        RoundUp(embedded_blob_code_size, base::OS::kTransparentHugePageSize);
+    const Address huge_hint_address = RoundDown(
+        code_region_limit - huge_code_size, base::OS::kTransparentHugePageSize);
+    if (code_region_limit - code_region.begin() >= huge_code_size &&
+        huge_hint_address >= code_region.begin()) {
+      allocate_code_size = huge_code_size;
+      hint_address = huge_hint_address;
+    } else {
+      use_huge_pages = false;
+    }
+  }
+  void* hint = reinterpret_cast<void*>(hint_address);
+  const size_t allocate_code_alignment =
+      use_huge_pages ? base::OS::kTransparentHugePageSize : kAllocatePageSize;
 
   embedded_blob_code_copy =
       reinterpret_cast<uint8_t*>(page_allocator()->AllocatePages(
-          hint, allocate_code_size, kAllocatePageSize,
+          hint, allocate_code_size, allocate_code_alignment,
           PageAllocator::kNoAccessWillJitLater));
 
   if (!embedded_blob_code_copy) {
@@ -475,7 +508,17 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   }
 
   size_t code_size = RoundUp(embedded_blob_code_size, kCommitPageSize);
-  if constexpr (base::OS::IsRemapPageSupported()) {
+  if (use_huge_pages) {
+    // Make the whole copy accessible so that the trailing huge page does not
+    // end up in a separate mapping. The advice has to happen before the copy
+    // populates the pages.
+    DCHECK(IsAligned(reinterpret_cast<Address>(embedded_blob_code_copy),
+                     base::OS::kTransparentHugePageSize));
+    code_size = allocate_code_size;
+#if V8_OS_LINUX
+    USE(base::OS::AdviseHugePages(embedded_blob_code_copy, allocate_code_size));
+#endif  // V8_OS_LINUX
+  } else if constexpr (base::OS::IsRemapPageSupported()) {
     // By default, the embedded builtins are not remapped, but copied. This
     // costs memory, since builtins become private dirty anonymous memory,
     // rather than shared, clean, file-backed memory for the embedded version.
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <optional>
 #include <stack>
 #include <unordered_map>
 
@@ -392,6 +393,10 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
     }
     PtrComprCageBase cage_base(isolate);
     const bool is_per_context_mode = local_marking_worklists.IsPerContextMode();
+    std::optional<MarkingWorklistPrefetcher> prefetcher;
+    if (v8_flags.marking_prefetch && !is_per_context_mode) {
+      prefetcher.emplace(&local_marking_worklists);
+    }
     bool done = false;
     while (!done) {
       size_t current_marked_bytes = 0;
@@ -399,7 +404,8 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       while (current_marked_bytes < kBytesUntilInterruptCheck &&
              objects_processed < kObjectsUntilInterruptCheck) {
         Tagged<HeapObject> object;
-        if (!local_marking_worklists.Pop(&object)) {
+        if (!(prefetcher ? prefetcher->Pop(&object)
+                         : local_marking_worklists.Pop(&object))) {
           done = true;
           break;
         }
@@ -460,6 +466,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
 
     CHECK(local_weak_objects.current_ephemerons_local.IsLocalEmpty());
 
+    if (prefetcher) prefetcher->Flush();
     local_marking_worklists.Publish();
     local_weak_objects.Publish();
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
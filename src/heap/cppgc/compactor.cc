@@ -42,6 +42,12 @@ class MovableReferences final {
   explicit MovableReferences(HeapBase& heap)
       : heap_(heap), heap_has_move_listeners_(heap.HasMoveListeners()) {}
 
+  // Reserves space for |expected_slots| recorded slots to avoid rehashing
+  // while filtering slots.
+  void Reserve(size_t expected_slots) {
+    movable_references_.reserve(expected_slots);
+  }
+
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(MovableReference*);
 
@@ -510,18 +516,33 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   MovableReferences movable_references(*heap_.heap());
 
-  CompactionWorklists::MovableReferencesWorklist::Local local(
-      *compaction_worklists_->movable_slots_worklist());
-  CompactionWorklists::MovableReference* slot;
-  while (local.Pop(&slot)) {
-    movable_references.AddOrFilter(slot);
+  {
+    StatsCollector::EnabledScope filter_scope(
+        heap_.heap()->stats_collector(), StatsCollector::kCompactFilterSlots);
+    using MovableReferencesWorklist =
+        CompactionWorklists::MovableReferencesWorklist;
+    MovableReferencesWorklist* worklist =
+        compaction_worklists_->movable_slots_worklist();
+    // The worklist only tracks its number of segments, which yields an
+    // estimate for the number of recorded slots.
+    movable_references.Reserve(worklist->Size() *
+                               MovableReferencesWorklist::kMinSegmentSize);
+    MovableReferencesWorklist::Local local(*worklist);
+    CompactionWorklists::MovableReference* slot;
+    while (local.Pop(&slot)) {
+      movable_references.AddOrFilter(slot);
+    }
   }
   compaction_worklists_.reset();
 
   const StickyBits sticky_bits = heap_.heap()->sticky_bits();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(space, movable_references, sticky_bits);
+  {
+    StatsCollector::EnabledScope compact_scope(
+        heap_.heap()->stats_collector(), StatsCollector::kCompactSpaces);
+    for (NormalPageSpace* space : compactable_spaces_) {
+      CompactSpace(space, movable_references, sticky_bits);
+    }
   }
 
   enable_for_next_gc_for_testing_ = false;
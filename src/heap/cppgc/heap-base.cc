@@ -151,8 +151,12 @@ std::unique_ptr<PageBackend> HeapBase::InitializePageBackend(
     PageAllocator& allocator) {
 #if defined(CPPGC_CAGED_HEAP)
   auto& caged_heap = CagedHeap::Instance();
-  return std::make_unique<PageBackend>(caged_heap.page_allocator(),
-                                       caged_heap.page_allocator());
+  auto page_backend = std::make_unique<PageBackend>(
+      caged_heap.page_allocator(), caged_heap.page_allocator());
+  // The cage is shared by all heaps and lives as long as the process, so
+  // unused pages can be recycled across heaps.
+  page_backend->EnableProcessWidePagePool();
+  return page_backend;
 #else   // !CPPGC_CAGED_HEAP
   return std::make_unique<PageBackend>(allocator, allocator);
 #endif  // !CPPGC_CAGED_HEAP
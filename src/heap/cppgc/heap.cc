@@ -52,6 +52,21 @@ void Heap::ForceGarbageCollectionSlow(const char* source, const char* reason,
        internal::GCConfig::IsForcedGC::kForced});
 }
 
+void Heap::ForceYoungGarbageCollectionSlow(const char* source,
+                                           const char* reason,
+                                           Heap::StackState stack_state) {
+  internal::Heap* heap = internal::Heap::From(this);
+  // Young collections require generational GC to be active, which only
+  // happens from the atomic pause of a full collection.
+  const internal::CollectionType collection_type =
+      heap->generational_gc_supported() ? internal::CollectionType::kMinor
+                                        : internal::CollectionType::kMajor;
+  heap->CollectGarbage({collection_type, stack_state, MarkingType::kAtomic,
+                        SweepingType::kAtomic,
+                        internal::GCConfig::FreeMemoryHandling::kDoNotDiscard,
+                        internal::GCConfig::IsForcedGC::kForced});
+}
+
 AllocationHandle& Heap::GetAllocationHandle() {
   return internal::Heap::From(this)->object_allocator();
 }
@@ -80,6 +95,9 @@ Heap::Heap(std::shared_ptr<cppgc::Platform> platform,
       growing_(&gc_invoker_, stats_collector_.get(),
                options.resource_constraints, options.marking_support,
                options.sweeping_support) {
+#if defined(CPPGC_YOUNG_GENERATION)
+  if (options.young_generation_support) EnableGenerationalGC();
+#endif  // defined(CPPGC_YOUNG_GENERATION)
   CHECK_IMPLIES(options.marking_support != HeapBase::MarkingType::kAtomic,
                 platform_->GetForegroundTaskRunner());
   CHECK_IMPLIES(options.sweeping_support != HeapBase::SweepingType::kAtomic,
@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "include/v8config.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
 #include "src/base/sanitizer/asan.h"
 #include "src/heap/cppgc/memory.h"
@@ -194,12 +195,79 @@ void NormalPageMemoryPool::ReleasePooledPages(PageAllocator& page_allocator) {
   }
 }
 
+// static
+ProcessWidePageMemoryPool& ProcessWidePageMemoryPool::Instance() {
+  static v8::base::LeakyObject<ProcessWidePageMemoryPool> instance;
+  return *instance.get();
+}
+
+void ProcessWidePageMemoryPool::Add(std::unique_ptr<PageMemoryRegion> region,
+                                    bool is_decommitted) {
+  DCHECK_NOT_NULL(region);
+  DCHECK_EQ(region->region().size(), kPageSize);
+  {
+    v8::base::MutexGuard guard(&mutex_);
+    if (pool_.size() < kMaxPooledRegions) {
+      if (!is_decommitted) {
+        // Pooled pages are zero-initialized, which discarding preserves.
+        ASAN_UNPOISON_MEMORY_REGION(region->region().base(),
+                                    region->region().size());
+        CHECK(TryDiscard(region->allocator(), region->region()));
+      }
+      pool_.push_back({std::move(region), is_decommitted});
+      return;
+    }
+  }
+  // The pool is full; |region| is freed when going out of scope.
+}
+
+std::unique_ptr<PageMemoryRegion> ProcessWidePageMemoryPool::Take(
+    PageAllocator& allocator) {
+  Entry entry;
+  {
+    v8::base::MutexGuard guard(&mutex_);
+    auto it = std::find_if(pool_.rbegin(), pool_.rend(),
+                           [&allocator](const Entry& e) {
+                             return &e.region->allocator() == &allocator;
+                           });
+    if (it == pool_.rend()) return {};
+    entry = std::move(*it);
+    pool_.erase(std::next(it).base());
+  }
+  void* base = entry.region->region().base();
+  const size_t size = entry.region->region().size();
+  ASAN_UNPOISON_MEMORY_REGION(base, size);
+  if (entry.is_decommitted) {
+    CHECK(allocator.RecommitPages(base, size, v8::PageAllocator::kReadWrite));
+    CHECK(TryUnprotect(allocator, entry.region->region()));
+  }
+#if DEBUG
+  CheckMemoryIsZero(base, size);
+#endif
+  return std::move(entry.region);
+}
+
+size_t ProcessWidePageMemoryPool::pooled() const {
+  v8::base::MutexGuard guard(&mutex_);
+  return pool_.size();
+}
+
 PageBackend::PageBackend(PageAllocator& normal_page_allocator,
                          PageAllocator& large_page_allocator)
     : normal_page_allocator_(normal_page_allocator),
       large_page_allocator_(large_page_allocator) {}
 
-PageBackend::~PageBackend() = default;
+PageBackend::~PageBackend() {
+  if (!use_process_wide_page_pool_) return;
+  // Recycle unused pages in other heaps instead of returning them to the OS.
+  page_pool_.Drain([this](PageMemoryRegion* pmr, bool is_decommitted) {
+    auto it = normal_page_memory_regions_.find(pmr);
+    DCHECK_NE(normal_page_memory_regions_.end(), it);
+    ProcessWidePageMemoryPool::Instance().Add(std::move(it->second),
+                                              is_decommitted);
+    normal_page_memory_regions_.erase(it);
+  });
+}
 
 Address PageBackend::TryAllocateNormalPageMemory() {
   v8::base::MutexGuard guard(&mutex_);
@@ -210,6 +278,15 @@ Address PageBackend::TryAllocateNormalPageMemory() {
     page_memory_region_tree_.Add(cached);
     return region.base();
   }
+  if (use_process_wide_page_pool_) {
+    if (auto pmr = ProcessWidePageMemoryPool::Instance().Take(
+            normal_page_allocator_)) {
+      const auto memory_region = pmr->region();
+      page_memory_region_tree_.Add(pmr.get());
+      normal_page_memory_regions_.emplace(pmr.get(), std::move(pmr));
+      return memory_region.base();
+    }
+  }
   auto pmr = CreateNormalPageMemoryRegion(normal_page_allocator_);
   if (!pmr) {
     return nullptr;
@@ -113,6 +113,16 @@ class V8_EXPORT_PRIVATE NormalPageMemoryPool final {
   void SetDecommitPooledPages(bool value) { decommit_pooled_pages_ = value; }
   static constexpr bool kDefaultDecommitPooledPage = false;
 
+  // Removes all entries from the pool and passes them to |callback| along
+  // with whether their memory is decommitted.
+  template <typename Callback>
+  void Drain(Callback callback) {
+    for (auto& entry : pool_) {
+      callback(entry.region, entry.is_decommitted);
+    }
+    pool_.clear();
+  }
+
  private:
   // The pool of pages that are not returned to the OS. Bounded by
   // `primary_pool_capacity_`.
@@ -129,6 +139,37 @@ class V8_EXPORT_PRIVATE NormalPageMemoryPool final {
   bool decommit_pooled_pages_ = kDefaultDecommitPooledPage;
 };
 
+// A process-wide pool of normal page memory that outlives the heaps it was
+// allocated for. Backends that opt in hand over their pooled pages when they
+// are destroyed and take pages from this pool before reserving new memory.
+// Pooled pages are discarded or decommitted and thus mostly cost address
+// space.
+class V8_EXPORT_PRIVATE ProcessWidePageMemoryPool final {
+ public:
+  // Bounds the address space kept alive by the pool.
+  static constexpr size_t kMaxPooledRegions = 256;
+
+  static ProcessWidePageMemoryPool& Instance();
+
+  // Adds |region| to the pool. The region is freed if the pool is full.
+  void Add(std::unique_ptr<PageMemoryRegion> region, bool is_decommitted);
+  // Takes an accessible and zero-initialized region that was allocated from
+  // |allocator|, or nullptr in case there is none.
+  std::unique_ptr<PageMemoryRegion> Take(PageAllocator& allocator);
+
+  // Returns the number of entries pooled.
+  size_t pooled() const;
+
+ private:
+  struct Entry {
+    std::unique_ptr<PageMemoryRegion> region;
+    bool is_decommitted;
+  };
+
+  mutable v8::base::Mutex mutex_;
+  std::vector<Entry> pool_;
+};
+
 // A backend that is used for allocating and freeing normal and large pages.
 //
 // Internally maintains a set of PageMemoryRegions. The backend keeps its used
@@ -173,6 +214,11 @@ class V8_EXPORT_PRIVATE PageBackend final {
 
   NormalPageMemoryPool& page_pool() { return page_pool_; }
 
+  // Shares unused normal pages with other backends of this process through
+  // the ProcessWidePageMemoryPool. Requires the normal page allocator to
+  // outlive the backend, as pooled regions keep referring to it.
+  void EnableProcessWidePagePool() { use_process_wide_page_pool_ = true; }
+
  private:
   // Guards against concurrent uses of `Lookup()`.
   mutable v8::base::Mutex mutex_;
@@ -190,6 +236,7 @@ class V8_EXPORT_PRIVATE PageBackend final {
       normal_page_memory_regions_;
   std::unordered_map<PageMemoryRegion*, std::unique_ptr<PageMemoryRegion>>
       large_page_memory_regions_;
+  bool use_process_wide_page_pool_ = false;
 };
 
 PageMemoryRegion* PageMemoryRegionTree::Lookup(ConstAddress address) const {
@@ -35,6 +35,8 @@ namespace internal {
 
 #define CPPGC_FOR_ALL_SCOPES(V)             \
   V(Unmark)                                 \
+  V(CompactFilterSlots)                     \
+  V(CompactSpaces)                          \
   V(MarkIncrementalStart)                   \
   V(MarkIncrementalFinalize)                \
   V(MarkAtomicPrologue)                     \
@@ -917,6 +917,15 @@ template <template <typename> typename HandleType>
 HandleType<String>::MaybeType FactoryBase<Impl>::NewConsString(
     HandleType<String> left, HandleType<String> right,
     AllocationType allocation) {
+  // Use the flat contents of already flattened cons strings directly, so that
+  // repeated concatenation does not keep adding levels of indirection until
+  // the next GC shortcuts them.
+  if (IsConsString(*left) && Cast<ConsString>(*left)->IsFlat()) {
+    left = HandleType<String>(Cast<ConsString>(*left)->first(), isolate());
+  }
+  if (IsConsString(*right) && Cast<ConsString>(*right)->IsFlat()) {
+    right = HandleType<String>(Cast<ConsString>(*right)->first(), isolate());
+  }
   if (IsThinString(*left)) {
     left = HandleType<String>(Cast<ThinString>(*left)->actual(), isolate());
   }
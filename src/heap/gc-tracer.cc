@@ -370,6 +370,14 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
   FetchBackgroundCounters();
 
   const base::TimeDelta duration = current_.end_time - current_.start_time;
+  if (!pause_budget_.IsZero() && duration > pause_budget_) {
+    pause_budget_violations_++;
+    if (v8_flags.trace_gc) {
+      heap_->isolate()->PrintWithTimestamp(
+          "GC pause of %.1f ms exceeded the budget of %.1f ms\n",
+          duration.InMillisecondsF(), pause_budget_.InMillisecondsF());
+    }
+  }
   auto* long_task_stats = heap_->isolate()->GetCurrentLongTaskStats();
   const bool is_young = Heap::IsYoungGenerationCollector(collector);
   if (is_young) {
@@ -708,6 +716,11 @@ void GCTracer::SampleConcurrencyEsimate(size_t concurrency) {
   current_.concurrency_estimate = concurrency;
 }
 
+void GCTracer::SampleScavengerSegmentsStolen(size_t segments_stolen) {
+  DCHECK_EQ(current_.type, Event::Type::SCAVENGER);
+  current_.scavenger_segments_stolen = segments_stolen;
+}
+
 void GCTracer::NotifyMarkingStart() {
   const auto marking_start = base::TimeTicks::Now();
 
@@ -947,7 +960,9 @@ void GCTracer::PrintNVP() const {
           .p("quarantined_size",
              heap_->semi_space_new_space()->QuarantinedSize())
           .p("quarantined_pages",
-             heap_->semi_space_new_space()->QuarantinedPageCount());
+             heap_->semi_space_new_space()->QuarantinedPageCount())
+          .p("concurrency_estimate", current_.concurrency_estimate)
+          .p("segments_stolen", current_.scavenger_segments_stolen);
       break;
     case Event::Type::MINOR_MARK_SWEEPER:
     case Event::Type::INCREMENTAL_MINOR_MARK_SWEEPER:
@@ -255,6 +255,10 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Approximate number of threads that contributed in garbage collection.
     size_t concurrency_estimate = 1;
 
+    // Number of worklist segments taken from global pools by scavenger tasks
+    // that ran out of local work.
+    size_t scavenger_segments_stolen = 0;
+
     // Duration (in ms) of incremental marking steps for
     // INCREMENTAL_MARK_COMPACTOR.
     base::TimeDelta incremental_marking_duration;
@@ -362,6 +366,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   bool IsSweepingInProgress() const;
 #endif
 
+  GarbageCollectionReason CurrentGCReason() const {
+    return current_.gc_reason;
+  }
+
   // Sample and accumulate bytes allocated since the last GC.
   void SampleAllocation(base::TimeTicks current, size_t new_space_counter_bytes,
                         size_t old_generation_counter_bytes,
@@ -373,6 +381,8 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void SampleConcurrencyEsimate(size_t concurrency);
 
+  void SampleScavengerSegmentsStolen(size_t segments_stolen);
+
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
@@ -471,6 +481,14 @@ class V8_EXPORT_PRIVATE GCTracer {
   std::optional<base::TimeDelta> AverageTimeToIncrementalMarkingTask() const;
   void RecordTimeToIncrementalMarkingTask(base::TimeDelta time_to_task);
 
+  // Maximum duration of an observable pause requested by the embedder. A zero
+  // budget means that no budget is in effect.
+  void SetPauseBudget(base::TimeDelta budget) { pause_budget_ = budget; }
+  base::TimeDelta pause_budget() const { return pause_budget_; }
+
+  // Returns the number of observable pauses that exceeded the pause budget.
+  size_t pause_budget_violations() const { return pause_budget_violations_; }
+
 #ifdef V8_RUNTIME_CALL_STATS
   V8_INLINE WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats();
 #endif  // defined(V8_RUNTIME_CALL_STATS)
@@ -576,6 +594,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::TimeTicks previous_mark_compact_end_time_;
   base::TimeDelta total_duration_since_last_mark_compact_;
 
+  base::TimeDelta pause_budget_;
+  size_t pause_budget_violations_ = 0;
+
   BytesAndDurationBuffer recorded_compactions_;
   BytesAndDurationBuffer recorded_incremental_mark_compacts_;
   BytesAndDurationBuffer recorded_mark_compacts_;
@@ -644,6 +665,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
+  FRIEND_TEST(GCTracerTest, PauseBudget);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
 };
@@ -66,6 +66,7 @@
 #include "src/heap/heap-visitor.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/large-page-metadata-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/mark-compact-inl.h"
@@ -659,6 +660,18 @@ void Heap::PrintShortHeapStatistics() {
                trusted_lo_space_->SizeOfObjects() / KB,
                trusted_lo_space_->Available() / KB,
                trusted_lo_space_->CommittedMemory() / KB);
+  if (shared_space_) {
+    PrintIsolate(isolate_,
+                 "Shared space,               used: %6zu KB"
+                 ", available:  %7zu KB"
+                 ", committed: %6zu KB"
+                 ", allocation locks: %zu (%zu contended)\n",
+                 shared_space_->SizeOfObjects() / KB,
+                 shared_space_->Available() / KB,
+                 shared_space_->CommittedMemory() / KB,
+                 shared_space_->allocation_mutex_acquisitions(),
+                 shared_space_->contended_allocation_mutex_acquisitions());
+  }
   ReadOnlySpace* const ro_space = read_only_space_;
   PrintIsolate(isolate_,
                "All spaces,                 used: %6zu KB"
@@ -2308,6 +2321,9 @@ void Heap::PerformGarbageCollection(GarbageCollector collector,
   // pretenuring decisions. The numbers collected in the GC will be for the
   // capacity that was set before the GC.
   pretenuring_handler_.ProcessPretenuringFeedback(new_space_capacity_before_gc);
+  if (collector == GarbageCollector::MARK_COMPACTOR) {
+    pretenuring_handler_.ClearStalePretenuringHints();
+  }
 
   UpdateSurvivalStatistics(static_cast<int>(start_young_generation_size));
   ShrinkOldGenerationAllocationLimitIfNotConfigured();
@@ -3583,6 +3599,17 @@ void Heap::RightTrimArray(Tagged<Array> object, int new_capacity,
   // avoid races with the sweeper thread.
   object->set_capacity(new_capacity, kReleaseStore);
 
+  // The concurrent marker may still be visiting the old extent of the array,
+  // so only discard the tail when not marking.
+  if (V8_UNLIKELY(v8_flags.discard_trimmed_large_object_tails) &&
+      HeapLayout::InAnyLargeSpace(object) &&
+      !incremental_marking()->IsMarking()) {
+    LargePageMetadata* page =
+        LargePageMetadata::FromHeapObject(isolate(), object);
+    static_cast<LargeObjectSpace*>(page->owner())
+        ->DiscardUnusedTail(page, new_end, old_end);
+  }
+
   // Notify the heap object allocation tracker of change in object layout. The
   // array may not be moved during GC, and size has to be adjusted nevertheless.
   for (auto& tracker : allocation_trackers_) {
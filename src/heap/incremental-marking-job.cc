@@ -43,6 +43,21 @@ class IncrementalMarkingJob::Task final : public CancelableTask {
   const StackState stack_state_;
 };
 
+class IncrementalMarkingJob::IdleTask final : public CancelableIdleTask {
+ public:
+  IdleTask(Isolate* isolate, IncrementalMarkingJob* job)
+      : CancelableIdleTask(isolate), isolate_(isolate), job_(job) {}
+
+  // CancelableIdleTask overrides.
+  void RunInternal(double deadline_in_seconds) override;
+
+  Isolate* isolate() const { return isolate_; }
+
+ private:
+  Isolate* const isolate_;
+  IncrementalMarkingJob* const job_;
+};
+
 IncrementalMarkingJob::IncrementalMarkingJob(Heap* heap)
     : heap_(heap),
       user_blocking_task_runner_(
@@ -55,7 +70,13 @@ IncrementalMarkingJob::IncrementalMarkingJob(Heap* heap)
 void IncrementalMarkingJob::ScheduleTask(TaskPriority priority) {
   base::MutexGuard guard(&mutex_);
 
-  if (pending_task_ || heap_->IsTearingDown()) {
+  if (heap_->IsTearingDown()) {
+    return;
+  }
+
+  ScheduleIdleTaskLocked();
+
+  if (pending_task_) {
     return;
   }
 
@@ -99,6 +120,59 @@ void IncrementalMarkingJob::ScheduleTask(TaskPriority priority) {
   }
 }
 
+void IncrementalMarkingJob::ScheduleIdleTaskLocked() {
+  mutex_.AssertHeld();
+  if (!v8_flags.incremental_marking_idle_tasks || pending_idle_task_) {
+    return;
+  }
+  if (!user_blocking_task_runner_->IdleTasksEnabled()) {
+    return;
+  }
+  user_blocking_task_runner_->PostIdleTask(
+      std::make_unique<IdleTask>(heap_->isolate(), this));
+  pending_idle_task_ = true;
+}
+
+void IncrementalMarkingJob::IdleTask::RunInternal(double deadline_in_seconds) {
+  VMState<GC> state(isolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8",
+                                "V8.IncrementalMarkingJob.IdleTask");
+  SetCurrentIsolateScope isolate_scope(isolate());
+  SetCurrentLocalHeapScope thread_local_scope(isolate());
+
+  Heap* heap = isolate()->heap();
+  {
+    base::MutexGuard guard(&job_->mutex_);
+    job_->pending_idle_task_ = false;
+  }
+
+  IncrementalMarking* incremental_marking = heap->incremental_marking();
+  if (!incremental_marking->IsMajorMarking()) return;
+
+  // The deadline uses embedder timestamps.
+  const base::TimeDelta idle_time = base::TimeDelta::FromMillisecondsD(
+      (deadline_in_seconds * 1000) - heap->MonotonicallyIncreasingTimeInMs());
+  if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
+    isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Job: Run idle task with %.1fms idle time\n",
+        idle_time.InMillisecondsF());
+  }
+  if (idle_time <= base::TimeDelta()) {
+    return;
+  }
+
+  // Idle tasks may run nested within other tasks with stale pointers on the
+  // stack.
+  EmbedderStackStateScope scope(heap,
+                                EmbedderStackStateOrigin::kImplicitThroughTask,
+                                StackState::kMayContainHeapPointers);
+  incremental_marking->AdvanceOnIdle(idle_time);
+  if (incremental_marking->IsMajorMarking()) {
+    base::MutexGuard guard(&job_->mutex_);
+    job_->ScheduleIdleTaskLocked();
+  }
+}
+
 void IncrementalMarkingJob::Task::RunInternal() {
   VMState<GC> state(isolate());
   TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8",
@@ -18,7 +18,9 @@ class Isolate;
 
 // The incremental marking job uses platform tasks to perform incremental
 // marking actions (start, step, finalize). The job posts regular foreground
-// tasks or delayed foreground tasks if marking progress allows.
+// tasks or delayed foreground tasks if marking progress allows. With
+// --incremental-marking-idle-tasks it additionally posts idle tasks that use
+// the idle time reported by the embedder for marking steps.
 class IncrementalMarkingJob final {
  public:
   explicit IncrementalMarkingJob(Heap* heap);
@@ -39,6 +41,9 @@ class IncrementalMarkingJob final {
 
  private:
   class Task;
+  class IdleTask;
+
+  void ScheduleIdleTaskLocked();
 
   Heap* const heap_;
   const std::shared_ptr<v8::TaskRunner> user_blocking_task_runner_;
@@ -46,6 +51,7 @@ class IncrementalMarkingJob final {
   mutable base::Mutex mutex_;
   v8::base::TimeTicks scheduled_time_;
   bool pending_task_ = false;
+  bool pending_idle_task_ = false;
 };
 
 }  // namespace v8::internal
@@ -6,6 +6,7 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
 
@@ -63,16 +64,26 @@ static constexpr size_t kV8ActivationThreshold = 0;
 static constexpr size_t kGlobalActivationThreshold = 0;
 #endif  // DEBUG
 
-base::TimeDelta GetMaxDuration(StepOrigin step_origin) {
+base::TimeDelta GetMaxDuration(StepOrigin step_origin,
+                               base::TimeDelta pause_budget) {
   if (v8_flags.predictable) {
     return base::TimeDelta::Max();
   }
+  base::TimeDelta max_duration;
   switch (step_origin) {
     case StepOrigin::kTask:
-      return kMaxStepSizeOnTask;
+      max_duration = kMaxStepSizeOnTask;
+      break;
     case StepOrigin::kV8:
-      return kMaxStepSizeOnAllocation;
+      max_duration = kMaxStepSizeOnAllocation;
+      break;
   }
+  // Steps are pauses on the main thread and must not exceed the budget
+  // requested by the embedder.
+  if (!pause_budget.IsZero()) {
+    max_duration = std::min(max_duration, pause_budget);
+  }
+  return max_duration;
 }
 
 }  // namespace
@@ -206,6 +217,7 @@ void IncrementalMarking::Start(GarbageCollector garbage_collector,
   completion_task_timeout_ = v8::base::TimeTicks();
   main_thread_marked_bytes_ = 0;
   bytes_marked_concurrently_ = 0;
+  bytes_marked_at_last_ephemeron_round_ = 0;
 
   if (is_major) {
     StartMarkingMajor();
@@ -683,8 +695,8 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
-  Step(GetMaxDuration(StepOrigin::kTask), max_bytes_to_process,
-       StepOrigin::kTask);
+  Step(GetMaxDuration(StepOrigin::kTask, heap_->tracer()->pause_budget()),
+       max_bytes_to_process, StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
     heap()->FinalizeIncrementalMarkingAtomically(
         GarbageCollectionReason::kFinalizeMarkingViaTask);
@@ -701,6 +713,16 @@ void IncrementalMarking::AdvanceAndFinalizeIfNecessary() {
   }
 }
 
+void IncrementalMarking::AdvanceOnIdle(v8::base::TimeDelta idle_time) {
+  DCHECK(IsMajorMarking());
+  // Idle time is otherwise unused, so mark ahead of the schedule.
+  Step(idle_time, SIZE_MAX, StepOrigin::kTask);
+  if (IsMajorMarkingComplete()) {
+    heap()->FinalizeIncrementalMarkingAtomically(
+        GarbageCollectionReason::kFinalizeMarkingViaTask);
+  }
+}
+
 void IncrementalMarking::AdvanceForTesting(v8::base::TimeDelta max_duration,
                                            size_t max_bytes_to_mark) {
   Step(max_duration, max_bytes_to_mark, StepOrigin::kV8);
@@ -712,7 +734,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK(IsMajorMarking());
 
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kV8);
-  Step(GetMaxDuration(StepOrigin::kV8), max_bytes_to_process, StepOrigin::kV8);
+  Step(GetMaxDuration(StepOrigin::kV8, heap_->tracer()->pause_budget()),
+       max_bytes_to_process, StepOrigin::kV8);
 
   // Bail out when an AlwaysAllocateScope is active as the assumption is that
   // there's no GC being triggered. Check this condition at last position to
@@ -859,6 +882,9 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
 
   if (V8_LIKELY(v8_flags.concurrent_marking)) {
     local_marking_worklists()->ShareWork();
+    if (v8_flags.incremental_ephemeron_processing) {
+      ScheduleConcurrentEphemeronRound();
+    }
     heap_->concurrent_marking()->RescheduleJobIfNeeded(
         GarbageCollector::MARK_COMPACTOR);
   }
@@ -884,6 +910,20 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
   }
 }
 
+void IncrementalMarking::ScheduleConcurrentEphemeronRound() {
+  DCHECK(v8_flags.concurrent_marking);
+  if (!weak_objects_->current_ephemerons.IsEmpty()) return;
+  if (!major_collector_->marking_worklists()->IsEmpty()) return;
+  const size_t marked_bytes =
+      main_thread_marked_bytes_ + bytes_marked_concurrently_;
+  // Without new marked objects, no ephemeron key can have become reachable.
+  if (marked_bytes <= bytes_marked_at_last_ephemeron_round_) return;
+  major_collector_->local_weak_objects()->next_ephemerons_local.Publish();
+  if (weak_objects_->next_ephemerons.IsEmpty()) return;
+  bytes_marked_at_last_ephemeron_round_ = marked_bytes;
+  weak_objects_->current_ephemerons.Merge(weak_objects_->next_ephemerons);
+}
+
 Isolate* IncrementalMarking::isolate() const { return heap_->isolate(); }
 
 // The allocation observer step size determines the LAB size when marking is on.
@@ -97,6 +97,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // marking completes.
   void AdvanceOnAllocation();
 
+  // Performs an incremental marking step bounded only by the |idle_time| the
+  // embedder reported and finalizes marking if complete.
+  void AdvanceOnIdle(v8::base::TimeDelta idle_time);
+
   bool IsCompacting() { return IsMajorMarking() && is_compacting_; }
 
   Heap* heap() const { return heap_; }
@@ -158,6 +162,11 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   bool ShouldFinalize() const;
 
+  // Hands ephemerons with unmarked keys back to the concurrent markers once
+  // the marking worklists ran empty and marking made progress since the last
+  // round, so that they are resolved before the atomic pause.
+  void ScheduleConcurrentEphemeronRound();
+
   bool ShouldWaitForTask();
   bool TryInitializeTaskTimeout();
 
@@ -187,6 +196,8 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // A sample of concurrent_marking()->TotalMarkedBytes() at the last
   // incremental marking step.
   size_t bytes_marked_concurrently_ = 0;
+  // Marked bytes at the last round of concurrent ephemeron processing.
+  size_t bytes_marked_at_last_ephemeron_round_ = 0;
   MarkingMode marking_mode_ = MarkingMode::kNoMarking;
 
   bool is_compacting_ = false;
@@ -260,6 +260,19 @@ void LargeObjectSpace::ShrinkPageToObjectSize(LargePageMetadata* page,
   DCHECK_EQ(object_size, page->area_size());
 }
 
+void LargeObjectSpace::DiscardUnusedTail(LargePageMetadata* page,
+                                         Address start, Address end) {
+  DCHECK(!page->is_executable());
+  DCHECK_LE(page->area_start(), start);
+  DCHECK_LE(end, page->area_end());
+  const size_t commit_page_size = MemoryAllocator::GetCommitPageSize();
+  const Address discard_start = ::RoundUp(start, commit_page_size);
+  const Address discard_end = ::RoundDown(end, commit_page_size);
+  if (discard_end <= discard_start) return;
+  USE(page->reserved_memory()->DiscardSystemPages(discard_start,
+                                                  discard_end - discard_start));
+}
+
 void LargeObjectSpace::UpdateAccountingAfterResizingObject(
     size_t old_object_size, size_t new_object_size) {
   DCHECK_GE(new_object_size, old_object_size);
@@ -54,6 +54,11 @@ class V8_EXPORT_PRIVATE LargeObjectSpace : public Space {
   void ShrinkPageToObjectSize(LargePageMetadata* page,
                               Tagged<HeapObject> object, size_t object_size);
 
+  // Returns the OS pages in [start, end) of |page|, which are no longer used
+  // by its object, to the OS without giving up the reservation. The page
+  // itself is shrunk when the next full GC calls ShrinkPageToObjectSize().
+  void DiscardUnusedTail(LargePageMetadata* page, Address start, Address end);
+
   // Checks whether a heap object is in this space; O(1).
   bool Contains(Tagged<HeapObject> obj) const;
   // Checks whether an address is in the object area in this space. Iterates all
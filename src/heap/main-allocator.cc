@@ -4,6 +4,7 @@
 
 #include "src/heap/main-allocator.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/logging.h"
@@ -820,6 +821,11 @@ void PagedSpaceAllocatorPolicy::SetLinearAllocationArea(Address top,
   }
 }
 
+bool PagedSpaceAllocatorPolicy::UsesAdaptiveLabSize() const {
+  return v8_flags.adaptive_shared_space_labs &&
+         allocator_->identity() == SHARED_SPACE && !allocator_->in_gc();
+}
+
 bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
     size_t size_in_bytes, AllocationOrigin origin) {
   PagedSpace::ConcurrentAllocationMutex guard(space_);
@@ -836,10 +842,29 @@ bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
             size_in_bytes);
 
   size_t new_node_size = 0;
+  const bool adaptive_lab_size = UsesAdaptiveLabSize();
+  const size_t lab_size =
+      adaptive_lab_size ? std::max(size_in_bytes, min_free_list_lab_size_)
+                        : size_in_bytes;
   Tagged<FreeSpace> new_node = space_->free_list_->Allocate(
-      space_->heap(), size_in_bytes, &new_node_size, origin);
+      space_->heap(), lab_size, &new_node_size, origin);
+  if (new_node.is_null() && lab_size > size_in_bytes) {
+    // The free list is too fragmented for the adaptive size.
+    new_node = space_->free_list_->Allocate(space_->heap(), size_in_bytes,
+                                            &new_node_size, origin);
+  }
   if (new_node.is_null()) return false;
   DCHECK_GE(new_node_size, size_in_bytes);
+  if (adaptive_lab_size) {
+    // Grow the LAB size with every refill and shrink it again when the free
+    // list could not provide it.
+    static constexpr size_t kMinAdaptiveLabSize = 1 * KB;
+    min_free_list_lab_size_ =
+        new_node_size >= lab_size
+            ? std::clamp(2 * min_free_list_lab_size_, kMinAdaptiveLabSize,
+                         size_t{kLabSizeInGC})
+            : min_free_list_lab_size_ / 2;
+  }
 
   // The old-space-step might have finished sweeping and restarted marking.
   // Verify that it did not turn the page of the new node into an evacuation
@@ -93,8 +93,16 @@ class PagedSpaceAllocatorPolicy final : public AllocatorPolicy {
 
   void FreeLinearAllocationAreaUnsynchronized();
 
+  // Whether LABs refilled from the free list use min_free_list_lab_size_.
+  bool UsesAdaptiveLabSize() const;
+
   PagedSpaceBase* const space_;
 
+  // With --adaptive-shared-space-labs, the minimum size of LABs taken from
+  // the free list of the shared space. Grows with every refill such that
+  // threads allocating many small objects take the space mutex less often.
+  size_t min_free_list_lab_size_ = 0;
+
   friend class PagedNewSpaceAllocatorPolicy;
 };
 
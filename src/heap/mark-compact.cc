@@ -397,6 +397,17 @@ base::EnumSet<CodeFlushMode> GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kForceFlush);
   }
 
+  // Under memory pressure the embedder asked for as much memory as possible to
+  // be released, so don't wait for functions to age. GCs started by the memory
+  // reducer are excluded as flushing everything in an idle but visible page
+  // leads to recompilation once it becomes active again.
+  if (v8_flags.flush_code_on_memory_pressure &&
+      isolate->heap()->ShouldReduceMemory() &&
+      isolate->heap()->tracer()->CurrentGCReason() ==
+          GarbageCollectionReason::kMemoryPressure) {
+    code_flush_mode.Add(CodeFlushMode::kForceFlush);
+  }
+
   return code_flush_mode;
 }
 
@@ -603,6 +614,22 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    // A pause budget set by the embedder takes precedence over the flag.
+    const base::TimeDelta pause_budget = heap_->tracer()->pause_budget();
+    const double pause_budget_ms =
+        pause_budget.IsZero() ? v8_flags.compaction_pause_budget_ms
+                              : pause_budget.InMillisecondsF();
+    if (pause_budget_ms > 0 && estimated_compaction_speed.has_value()) {
+      // Bound the evacuation work by the pause budget. Pages that are not
+      // selected stay fragmented and are picked up by subsequent GCs, so
+      // compaction proceeds incrementally across cycles. At least one page is
+      // always allowed to make progress.
+      const double budget_bytes =
+          *estimated_compaction_speed * pause_budget_ms;
+      *max_evacuated_bytes = std::max(
+          area_size, static_cast<size_t>(std::min(
+                         budget_bytes, static_cast<double>(kMaxEvacuatedBytes))));
+    }
   }
 }
 
@@ -2255,8 +2282,16 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
         GarbageCollector::MARK_COMPACTOR, TaskPriority::kUserBlocking);
   }
 
-  while (local_marking_worklists_->Pop(&object) ||
-         local_marking_worklists_->PopOnHold(&object)) {
+  std::optional<MarkingWorklistPrefetcher> prefetcher;
+  if (v8_flags.marking_prefetch && !is_per_context_mode) {
+    prefetcher.emplace(local_marking_worklists_.get());
+  }
+  auto pop = [this, &prefetcher](Tagged<HeapObject>* object) {
+    return prefetcher ? prefetcher->Pop(object)
+                      : local_marking_worklists_->Pop(object);
+  };
+
+  while (pop(&object) || local_marking_worklists_->PopOnHold(&object)) {
     // The marking worklist should never contain filler objects.
     CHECK(!IsFreeSpaceOrFiller(object, cage_base));
     DCHECK(IsHeapObject(object));
@@ -2311,6 +2346,7 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       break;
     }
   }
+  if (prefetcher) prefetcher->Flush();
   return std::make_pair(bytes_processed, objects_processed);
 }
 
@@ -2391,6 +2427,9 @@ void MarkCompactCollector::MarkTransitiveClosure() {
   // Incremental marking might leave ephemerons in main task's local
   // buffer, flush it into global pool.
   local_weak_objects()->next_ephemerons_local.Publish();
+  // With --incremental-ephemeron-processing, ephemerons handed to concurrent
+  // markers may not have been processed yet.
+  weak_objects_.next_ephemerons.Merge(weak_objects_.current_ephemerons);
 
   if (!MarkTransitiveClosureUntilFixpoint()) {
     // Fixpoint iteration needed too many iterations and was cancelled. Use the
@@ -2693,6 +2732,56 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
   const uint64_t trace_id_;
 };
 
+#ifdef V8_ENABLE_SANDBOX
+// Sweeps the trusted and code pointer tables. Unlike the external pointer
+// table, these tables are never compacted, so sweeping only rewrites dead
+// entries into freelist entries and clears the mark bit of live ones. This
+// does not interfere with the remaining clearing work on the main thread,
+// which neither allocates table entries nor accesses dead ones.
+class SweepTrustedPointerTablesJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit SweepTrustedPointerTablesJobItem(Isolate* isolate)
+      : isolate_(isolate),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  isolate->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_SWEEP_TRUSTED_POINTER_TABLE)) {}
+
+  void Run(JobDelegate* delegate) final {
+    // Set the current isolate such that trusted pointer tables etc are
+    // available and the cage base is set correctly for multi-cage mode.
+    SetCurrentIsolateScope isolate_scope(isolate_);
+    Heap* heap = isolate_->heap();
+    const ThreadKind thread_kind = delegate->IsJoiningThread()
+                                       ? ThreadKind::kMain
+                                       : ThreadKind::kBackground;
+    {
+      TRACE_GC1_WITH_FLOW(heap->tracer(),
+                          GCTracer::Scope::MC_SWEEP_TRUSTED_POINTER_TABLE,
+                          thread_kind, trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+      isolate_->trusted_pointer_table().Sweep(heap->trusted_pointer_space(),
+                                              isolate_->counters());
+      if (isolate_->owns_shareable_data()) {
+        isolate_->shared_trusted_pointer_table().Sweep(
+            isolate_->shared_trusted_pointer_space(), isolate_->counters());
+      }
+    }
+    {
+      TRACE_GC1(heap->tracer(), GCTracer::Scope::MC_SWEEP_CODE_POINTER_TABLE,
+                thread_kind);
+      IsolateGroup::current()->code_pointer_table()->Sweep(
+          heap->code_pointer_space(), isolate_->counters());
+    }
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  Isolate* const isolate_;
+  const uint64_t trace_id_;
+};
+#endif  // V8_ENABLE_SANDBOX
+
 }  // namespace
 
 class FullStringForwardingTableCleaner final
@@ -3182,20 +3271,38 @@ void MarkCompactCollector::ClearNonLiveReferences() {
 #endif  // V8_COMPRESS_POINTERS
 
 #ifdef V8_ENABLE_SANDBOX
-  {
-    TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_SWEEP_TRUSTED_POINTER_TABLE);
-    isolate->trusted_pointer_table().Sweep(heap_->trusted_pointer_space(),
-                                           isolate->counters());
-    if (isolate->owns_shareable_data()) {
-      isolate->shared_trusted_pointer_table().Sweep(
-          isolate->shared_trusted_pointer_space(), isolate->counters());
+  // The trusted and code pointer tables are swept in parallel to the
+  // remaining clearing work and joined together with the other clearing jobs.
+  std::unique_ptr<JobHandle> sweep_trusted_pointer_tables_job_handle;
+  if (v8_flags.parallel_pointer_table_sweeping &&
+      UseBackgroundThreadsInCycle()) {
+    auto job = std::make_unique<ParallelClearingJob>(this);
+    auto job_item = std::make_unique<SweepTrustedPointerTablesJobItem>(isolate);
+    const uint64_t trace_id = job_item->trace_id();
+    job->Add(std::move(job_item));
+    TRACE_GC_NOTE_WITH_FLOW("SweepTrustedPointerTablesJob started", trace_id,
+                            TRACE_EVENT_FLAG_FLOW_OUT);
+    sweep_trusted_pointer_tables_job_handle =
+        V8::GetCurrentPlatform()->CreateJob(TaskPriority::kUserBlocking,
+                                            std::move(job));
+    sweep_trusted_pointer_tables_job_handle->NotifyConcurrencyIncrease();
+  } else {
+    {
+      TRACE_GC(heap_->tracer(),
+               GCTracer::Scope::MC_SWEEP_TRUSTED_POINTER_TABLE);
+      isolate->trusted_pointer_table().Sweep(heap_->trusted_pointer_space(),
+                                             isolate->counters());
+      if (isolate->owns_shareable_data()) {
+        isolate->shared_trusted_pointer_table().Sweep(
+            isolate->shared_trusted_pointer_space(), isolate->counters());
+      }
     }
-  }
 
-  {
-    TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_SWEEP_CODE_POINTER_TABLE);
-    IsolateGroup::current()->code_pointer_table()->Sweep(
-        heap_->code_pointer_space(), isolate->counters());
+    {
+      TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_SWEEP_CODE_POINTER_TABLE);
+      IsolateGroup::current()->code_pointer_table()->Sweep(
+          heap_->code_pointer_space(), isolate->counters());
+    }
   }
 #endif  // V8_ENABLE_SANDBOX
 
@@ -3237,6 +3344,11 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
     clear_string_table_job_handle->Join();
     clear_trivial_weakrefs_job_handle->Join();
+#ifdef V8_ENABLE_SANDBOX
+    if (sweep_trusted_pointer_tables_job_handle) {
+      sweep_trusted_pointer_tables_job_handle->Join();
+    }
+#endif  // V8_ENABLE_SANDBOX
   }
 
   if (v8_flags.sticky_mark_bits) {
@@ -55,6 +55,31 @@ void MarkingWorklists::Local::PublishCppHeapObjects() {
   cpp_marking_state_->Publish();
 }
 
+bool MarkingWorklistPrefetcher::Pop(Tagged<HeapObject>* object) {
+  // Refill the ring. After the initial fill this pops a single object.
+  while (size_ < kPrefetchDistance) {
+    Tagged<HeapObject> next;
+    if (!worklists_->Pop(&next)) break;
+#if defined(__GNUC__)
+    __builtin_prefetch(reinterpret_cast<void*>(next.address()));
+#endif
+    ring_[(head_ + size_) % kPrefetchDistance] = next;
+    size_++;
+  }
+  if (size_ == 0) return false;
+  *object = ring_[head_];
+  head_ = (head_ + 1) % kPrefetchDistance;
+  size_--;
+  return true;
+}
+
+void MarkingWorklistPrefetcher::Flush() {
+  for (; size_ > 0; size_--) {
+    worklists_->Push(ring_[head_]);
+    head_ = (head_ + 1) % kPrefetchDistance;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -206,6 +206,40 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
   std::unique_ptr<CppMarkingState> cpp_marking_state_;
 };
 
+// Pops objects from a local marking worklist a few entries ahead of their use
+// and prefetches their headers, so that the map load when visiting an object
+// overlaps with visiting the objects popped before it. Objects that were
+// popped ahead but not returned yet must be handed back to the worklist with
+// Flush() before the worklist is published or checked for emptiness.
+//
+// Not used in per-context mode, where the popping order determines which
+// context a visited object is attributed to.
+class MarkingWorklistPrefetcher final {
+ public:
+  static constexpr size_t kPrefetchDistance = 8;
+
+  explicit MarkingWorklistPrefetcher(MarkingWorklists::Local* worklists)
+      : worklists_(worklists) {
+    DCHECK(!worklists->IsPerContextMode());
+  }
+  ~MarkingWorklistPrefetcher() { DCHECK_EQ(size_, 0); }
+
+  MarkingWorklistPrefetcher(const MarkingWorklistPrefetcher&) = delete;
+  MarkingWorklistPrefetcher& operator=(const MarkingWorklistPrefetcher&) =
+      delete;
+
+  inline bool Pop(Tagged<HeapObject>* object);
+
+  // Pushes all objects that were popped ahead back to the worklist.
+  inline void Flush();
+
+ private:
+  MarkingWorklists::Local* const worklists_;
+  Tagged<HeapObject> ring_[kPrefetchDistance];
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -9,6 +9,7 @@
 
 #include "src/base/address-region.h"
 #include "src/base/macros.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -440,6 +441,19 @@ PageMetadata* MemoryAllocator::AllocatePage(
     return nullptr;
   }
 
+  if constexpr (base::OS::IsNumaBindingSupported()) {
+    if (V8_UNLIKELY(v8_flags.numa_local_pages)) {
+      // Pages are allocated by the main thread or a background LocalHeap. Keep
+      // them on the node of that thread, including pages from the pool which
+      // may have been populated by a thread on another node.
+      const int node = base::OS::GetCurrentNumaNode();
+      if (node >= 0) {
+        USE(base::OS::BindMemoryToNumaNode(chunk_info->chunk, chunk_info->size,
+                                           node));
+      }
+    }
+  }
+
   PageMetadata* metadata;
   MemoryChunk::MainThreadFlags trusted_flags;
   if (!chunk_info->optional_metadata) {
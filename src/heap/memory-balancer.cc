@@ -4,15 +4,76 @@
 
 #include "src/heap/memory-balancer.h"
 
+#include <atomic>
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Process-wide state for balancing a memory budget across heaps. Each balancer
+// publishes its live memory and demand when refreshing its limit and computes
+// its share from the totals over all balancers.
+class ProcessMemoryBudget final {
+ public:
+  struct Usage {
+    size_t live_memory;
+    double demand;
+  };
+
+  void set_budget(size_t budget) {
+    budget_.store(budget, std::memory_order_relaxed);
+  }
+  size_t budget() const { return budget_.load(std::memory_order_relaxed); }
+
+  // Publishes the usage of |balancer| and returns the total usage of all
+  // balancers.
+  Usage Update(const MemoryBalancer* balancer, size_t live_memory,
+               double demand) {
+    base::MutexGuard guard(&mutex_);
+    entries_[balancer] = {live_memory, demand};
+    Usage totals{0, 0};
+    for (const auto& entry : entries_) {
+      totals.live_memory += entry.second.live_memory;
+      totals.demand += entry.second.demand;
+    }
+    return totals;
+  }
+
+  void Remove(const MemoryBalancer* balancer) {
+    base::MutexGuard guard(&mutex_);
+    entries_.erase(balancer);
+  }
+
+ private:
+  std::atomic<size_t> budget_{0};
+  base::Mutex mutex_;
+  std::unordered_map<const MemoryBalancer*, Usage> entries_;
+};
+
+ProcessMemoryBudget& GetProcessMemoryBudget() {
+  static base::LeakyObject<ProcessMemoryBudget> instance;
+  return *instance.get();
+}
+
+}  // namespace
+
 MemoryBalancer::MemoryBalancer(Heap* heap, base::TimeTicks startup_time)
     : heap_(heap), last_measured_at_(startup_time) {}
 
+MemoryBalancer::~MemoryBalancer() { GetProcessMemoryBudget().Remove(this); }
+
+// static
+void MemoryBalancer::SetProcessMemoryBudget(size_t budget_in_bytes) {
+  GetProcessMemoryBudget().set_budget(budget_in_bytes);
+}
+
 void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
                                      base::TimeTicks time) {
   embedder_allocation_limit_ = embedder_allocation_limit;
@@ -26,10 +87,26 @@ void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
 void MemoryBalancer::RefreshLimit() {
   CHECK(major_allocation_rate_.has_value());
   CHECK(major_gc_speed_.has_value());
-  const size_t computed_limit =
-      live_memory_after_gc_ +
+  const double demand =
       sqrt(live_memory_after_gc_ * (major_allocation_rate_.value().rate()) /
-           (major_gc_speed_.value().rate()) / v8_flags.memory_balancer_c_value);
+           (major_gc_speed_.value().rate()));
+  size_t computed_limit;
+  ProcessMemoryBudget& process_budget = GetProcessMemoryBudget();
+  if (const size_t budget = process_budget.budget()) {
+    const ProcessMemoryBudget::Usage totals =
+        process_budget.Update(this, live_memory_after_gc_, demand);
+    const size_t extra_memory =
+        budget > totals.live_memory ? budget - totals.live_memory : 0;
+    computed_limit =
+        live_memory_after_gc_ +
+        (totals.demand > 0 ? static_cast<size_t>(extra_memory * demand /
+                                                 totals.demand)
+                           : 0);
+  } else {
+    process_budget.Remove(this);
+    computed_limit = live_memory_after_gc_ +
+                     demand / sqrt(v8_flags.memory_balancer_c_value);
+  }
 
   // 2 MB of extra space.
   // This allows the heap size to not decay to CurrentSizeOfObject()
@@ -20,9 +20,19 @@ class Heap;
 // and smooth them using an exponentially weighted moving average (EWMA).
 // Spawn a heartbeat task that monitors allocation rate.
 // Calculate heap limit and update it accordingly.
+//
+// With a process memory budget (see SetProcessMemoryBudget()), the memory
+// above the live memory of all balanced heaps is split between the heaps in
+// proportion to sqrt(live memory * allocation rate / GC speed), which
+// equalizes the marginal GC cost of memory across heaps.
 class MemoryBalancer {
  public:
   MemoryBalancer(Heap* heap, base::TimeTicks startup_time);
+  ~MemoryBalancer();
+
+  // Sets the budget shared by all balanced heaps of the process. A budget of
+  // 0 lets each heap compute its limit alone.
+  static void SetProcessMemoryBudget(size_t budget_in_bytes);
 
   void UpdateAllocationRate(size_t major_allocation_bytes,
                             base::TimeDelta major_allocation_duration);
@@ -5,6 +5,7 @@
 #include "src/heap/memory-pool.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr-inl.h"
@@ -162,12 +163,25 @@ bool MemoryPool::PoolImpl<PoolEntry>::MoveLocalToShared(
 }
 
 template <typename PoolEntry>
-void MemoryPool::PoolImpl<PoolEntry>::ReleaseShared() {
+void MemoryPool::PoolImpl<PoolEntry>::ReleaseShared(size_t retained_entries) {
   std::vector<std::pair<InternalTime, std::vector<PoolEntry>>> entries_to_free;
   {
     base::MutexGuard guard(&mutex_);
+    std::vector<PoolEntry> retained;
+    for (auto& entry : shared_pool_) {
+      std::vector<PoolEntry>& entries = entry.second;
+      while (retained.size() < retained_entries && !entries.empty()) {
+        retained.push_back(std::move(entries.back()));
+        entries.pop_back();
+      }
+    }
     entries_to_free = std::move(shared_pool_);
     shared_pool_.clear();
+    if (!retained.empty()) {
+      // Retained entries are never released by time, see ReleaseUpTo().
+      shared_pool_.emplace_back(std::numeric_limits<InternalTime>::max(),
+                                std::move(retained));
+    }
   }
   // Entries will be freed automatically here.
 }
@@ -401,8 +415,10 @@ void MemoryPool::ReleaseOnTearDown(Isolate* isolate) {
 
     if (!isolate->isolate_group()->FindAnotherIsolateLocked(isolate,
                                                             schedule_task)) {
-      // No other isolate could be found. Release pooled pages right away.
-      page_pool_.ReleaseShared();
+      // No other isolate could be found. Release pooled pages right away,
+      // except for those kept for the next isolate to be created.
+      page_pool_.ReleaseShared(
+          v8_flags.memory_pool_retained_pages_on_last_teardown);
       zone_pool_.ReleaseShared();
     }
   }
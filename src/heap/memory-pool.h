@@ -96,7 +96,7 @@ class MemoryPool final {
   // If a task can be scheduled on another isolate, freeing of pooled pages will
   // be delayed to give other isolates the chance to make use of its pooled
   // pages. If this is not possible pages will be freed immediately.
-  void ReleaseOnTearDown(Isolate* isolate);
+  V8_EXPORT_PRIVATE void ReleaseOnTearDown(Isolate* isolate);
 
   // Releases the pooled pages of a specific isolate immediately.
   V8_EXPORT_PRIVATE void ReleaseImmediately(Isolate* isolate);
@@ -105,7 +105,7 @@ class MemoryPool final {
   void ReleaseLargeImmediately();
 
   // Releases all the pooled pages immediately.
-  void ReleaseAllImmediately();
+  V8_EXPORT_PRIVATE void ReleaseAllImmediately();
 
   // Tear down this page pool. Frees all pooled pages immediately.
   void TearDown();
@@ -114,13 +114,13 @@ class MemoryPool final {
   void GarbageCollectionPrologue(Isolate* isolate, GarbageCollector collector);
 
   // Returns the number of pages in the local pool for the given isolate.
-  size_t GetCount(Isolate* isolate) const;
+  V8_EXPORT_PRIVATE size_t GetCount(Isolate* isolate) const;
 
   // Returns the number of pages in the shared pool.
-  size_t GetSharedCount() const;
+  V8_EXPORT_PRIVATE size_t GetSharedCount() const;
 
   // Returns the number of pages cached in all local pools and the shared pool.
-  size_t GetTotalCount() const;
+  V8_EXPORT_PRIVATE size_t GetTotalCount() const;
 
  private:
   class ReleasePooledChunksTask;
@@ -136,7 +136,9 @@ class MemoryPool final {
     void PutLocal(Isolate* isolate, PoolEntry entry);
     std::optional<PoolEntry> Get(Isolate* isolate);
     bool MoveLocalToShared(Isolate* isolate, InternalTime release_time);
-    void ReleaseShared();
+    // Releases the shared pool except for up to `retained_entries` entries,
+    // which are kept until they are reused or the pool is released entirely.
+    void ReleaseShared(size_t retained_entries = 0);
     void ReleaseLocal();
     void ReleaseLocal(Isolate* isolate);
     size_t ReleaseUpTo(InternalTime release_time);
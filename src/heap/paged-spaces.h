@@ -256,6 +256,17 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
 
   base::Mutex* mutex() { return &space_mutex_; }
 
+  // Number of times allocating threads took the space mutex, e.g. to refill
+  // their linear allocation area from the free list, and how many of those
+  // had to wait for another thread. Only counted with --trace-gc-verbose.
+  size_t allocation_mutex_acquisitions() const {
+    return allocation_mutex_acquisitions_.load(std::memory_order_relaxed);
+  }
+  size_t contended_allocation_mutex_acquisitions() const {
+    return contended_allocation_mutex_acquisitions_.load(
+        std::memory_order_relaxed);
+  }
+
   void UnlinkFreeListCategories(PageMetadata* page);
   size_t RelinkFreeListCategories(PageMetadata* page);
 
@@ -325,6 +336,8 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
 
   // Mutex guarding any concurrent access to the space.
   mutable base::Mutex space_mutex_;
+  mutable std::atomic<size_t> allocation_mutex_acquisitions_{0};
+  mutable std::atomic<size_t> contended_allocation_mutex_acquisitions_{0};
 
   std::atomic<size_t> committed_physical_memory_{0};
 
@@ -339,11 +352,35 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
    public:
     explicit ConcurrentAllocationMutex(const PagedSpaceBase* space) {
       if (space->SupportsConcurrentAllocation()) {
-        guard_.emplace(&space->space_mutex_);
+        if (V8_UNLIKELY(v8_flags.trace_gc_verbose)) {
+          LockAndCount(space);
+        } else {
+          space->space_mutex_.Lock();
+        }
+        mutex_ = &space->space_mutex_;
+      }
+    }
+
+    ~ConcurrentAllocationMutex() {
+      if (mutex_) mutex_->Unlock();
+    }
+
+    ConcurrentAllocationMutex(const ConcurrentAllocationMutex&) = delete;
+    ConcurrentAllocationMutex& operator=(const ConcurrentAllocationMutex&) =
+        delete;
+
+   private:
+    static void LockAndCount(const PagedSpaceBase* space) {
+      space->allocation_mutex_acquisitions_.fetch_add(
+          1, std::memory_order_relaxed);
+      if (!space->space_mutex_.TryLock()) {
+        space->contended_allocation_mutex_acquisitions_.fetch_add(
+            1, std::memory_order_relaxed);
+        space->space_mutex_.Lock();
       }
     }
 
-    std::optional<base::MutexGuard> guard_;
+    base::Mutex* mutex_ = nullptr;
   };
 
   bool SupportsConcurrentAllocation() const {
@@ -4,14 +4,22 @@
 
 #include "src/heap/pretenuring-handler.h"
 
+#include <unordered_set>
+#include <vector>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/heap-layout.h"
+#include "src/heap/heap.h"
 #include "src/heap/new-spaces.h"
 #include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
@@ -294,5 +302,152 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
 
 void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
 
+namespace {
+
+// Pretenuring hints are a header of kPretenuringHintsHeaderSize words (magic
+// number, source length, hint count) followed by three words per hint.
+constexpr uint32_t kPretenuringHintsMagicNumber = 0x50524554;
+constexpr size_t kPretenuringHintsHeaderSize = 3;
+constexpr size_t kPretenuringHintSize = 3;
+
+uint32_t ScriptSourceLength(Tagged<Script> script) {
+  Tagged<Object> source = script->source();
+  return IsString(source) ? Cast<String>(source)->length() : 0;
+}
+
+}  // namespace
+
+// static
+base::OwnedVector<uint8_t> PretenuringHandler::SerializePretenuringHints(
+    Isolate* isolate, DirectHandle<Script> script) {
+  std::set<PretenuringHint> hints;
+  {
+    HeapObjectIterator iterator(isolate->heap());
+    DisallowGarbageCollection no_gc;
+    for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!IsFeedbackVector(obj)) continue;
+      Tagged<FeedbackVector> vector = Cast<FeedbackVector>(obj);
+      Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+      if (shared->script() != *script) continue;
+      FeedbackMetadataIterator slots(vector->metadata(), no_gc);
+      while (slots.HasNext()) {
+        FeedbackSlot slot = slots.Next();
+        if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+        Tagged<HeapObject> literal_site;
+        if (!vector->Get(slot).GetHeapObjectIfStrong(&literal_site) ||
+            !IsAllocationSite(literal_site)) {
+          continue;
+        }
+        int index = 0;
+        for (Tagged<Object> site = literal_site; IsAllocationSite(site);
+             site = Cast<AllocationSite>(site)->nested_site(), index++) {
+          if (Cast<AllocationSite>(site)->pretenure_decision() ==
+              AllocationSite::kTenure) {
+            hints.emplace(shared->StartPosition(), slot.ToInt(), index);
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<uint32_t> words;
+  words.reserve(kPretenuringHintsHeaderSize +
+                kPretenuringHintSize * hints.size());
+  words.push_back(kPretenuringHintsMagicNumber);
+  words.push_back(ScriptSourceLength(*script));
+  words.push_back(static_cast<uint32_t>(hints.size()));
+  for (const auto& [position, slot, index] : hints) {
+    words.push_back(static_cast<uint32_t>(position));
+    words.push_back(static_cast<uint32_t>(slot));
+    words.push_back(static_cast<uint32_t>(index));
+  }
+  return base::OwnedCopyOf(reinterpret_cast<const uint8_t*>(words.data()),
+                           words.size() * sizeof(uint32_t));
+}
+
+bool PretenuringHandler::SetPretenuringHints(
+    DirectHandle<Script> script, base::Vector<const uint8_t> data) {
+  if (data.size() < kPretenuringHintsHeaderSize * sizeof(uint32_t) ||
+      data.size() % sizeof(uint32_t) != 0) {
+    return false;
+  }
+  std::vector<uint32_t> words(data.size() / sizeof(uint32_t));
+  MemCopy(words.data(), data.begin(), data.size());
+  if (words[0] != kPretenuringHintsMagicNumber ||
+      words[1] != ScriptSourceLength(*script) ||
+      words.size() !=
+          kPretenuringHintsHeaderSize + kPretenuringHintSize * words[2]) {
+    return false;
+  }
+  // Hints of dead scripts are only dropped after a full GC, so the total
+  // number of hints is bounded.
+  ClearPretenuringHints(script->id());
+  if (pretenuring_hints_count_ + words[2] > kMaxPretenuringHints) return false;
+  std::set<PretenuringHint>& hints = pretenuring_hints_[script->id()];
+  for (size_t i = kPretenuringHintsHeaderSize; i < words.size();
+       i += kPretenuringHintSize) {
+    hints.emplace(static_cast<int>(words[i]), static_cast<int>(words[i + 1]),
+                  static_cast<int>(words[i + 2]));
+  }
+  pretenuring_hints_count_ += hints.size();
+  return true;
+}
+
+void PretenuringHandler::ClearPretenuringHints(int script_id) {
+  auto it = pretenuring_hints_.find(script_id);
+  if (it == pretenuring_hints_.end()) return;
+  DCHECK_GE(pretenuring_hints_count_, it->second.size());
+  pretenuring_hints_count_ -= it->second.size();
+  pretenuring_hints_.erase(it);
+}
+
+void PretenuringHandler::ClearStalePretenuringHints() {
+  if (pretenuring_hints_.empty()) return;
+  std::unordered_set<int> live_script_ids;
+  Script::Iterator iterator(heap_->isolate());
+  for (Tagged<Script> script = iterator.Next(); !script.is_null();
+       script = iterator.Next()) {
+    if (pretenuring_hints_.contains(script->id())) {
+      live_script_ids.insert(script->id());
+    }
+  }
+  for (auto it = pretenuring_hints_.begin(); it != pretenuring_hints_.end();) {
+    if (live_script_ids.contains(it->first)) {
+      ++it;
+      continue;
+    }
+    DCHECK_GE(pretenuring_hints_count_, it->second.size());
+    pretenuring_hints_count_ -= it->second.size();
+    it = pretenuring_hints_.erase(it);
+  }
+}
+
+void PretenuringHandler::ApplyPretenuringHints(Tagged<FeedbackVector> vector,
+                                               int slot,
+                                               Tagged<AllocationSite> site) {
+  if (pretenuring_hints_.empty()) return;
+  Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+  Tagged<Object> script = shared->script();
+  if (!IsScript(script)) return;
+  auto it = pretenuring_hints_.find(Cast<Script>(script)->id());
+  if (it == pretenuring_hints_.end()) return;
+  const int position = shared->StartPosition();
+  int index = 0;
+  for (Tagged<Object> current = site; IsAllocationSite(current);
+       current = Cast<AllocationSite>(current)->nested_site(), index++) {
+    if (!it->second.contains({position, slot, index})) continue;
+    Cast<AllocationSite>(current)->set_pretenure_decision(
+        AllocationSite::kTenure);
+    if (V8_UNLIKELY(v8_flags.trace_pretenuring)) {
+      PrintIsolate(heap_->isolate(),
+                   "pretenuring hint applied: AllocationSite(%p) at "
+                   "position %d, slot %d, index %d\n",
+                   reinterpret_cast<void*>(current.ptr()), position, slot,
+                   index);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
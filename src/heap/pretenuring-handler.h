@@ -6,7 +6,12 @@
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
 #include <memory>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 
+#include "src/base/vector.h"
+#include "src/handles/handles.h"
 #include "src/objects/allocation-site.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/map.h"
@@ -16,7 +21,9 @@ namespace internal {
 
 template <typename T>
 class GlobalHandleVector;
+class FeedbackVector;
 class Heap;
+class Script;
 
 class PretenuringHandler final {
  public:
@@ -84,7 +91,44 @@ class PretenuringHandler final {
 
   V8_EXPORT_PRIVATE static int GetMinMementoCountForTesting();
 
+  // ===========================================================================
+  // Persisted pretenuring decisions. ==========================================
+  // ===========================================================================
+
+  // Serializes the tenured allocation sites of literals in feedback vectors of
+  // functions of |script|. Sites are keyed by the function position, the
+  // literal slot and the index of the site within the literal, so that the
+  // result can be applied to the same script in another process.
+  V8_EXPORT_PRIVATE static base::OwnedVector<uint8_t>
+  SerializePretenuringHints(Isolate* isolate, DirectHandle<Script> script);
+
+  // Registers hints created by SerializePretenuringHints() for |script|,
+  // replacing previously registered ones. They are applied to the allocation
+  // sites of the script's literals as those are created. Returns false and
+  // ignores |data| if it is malformed, was produced for a script with a
+  // different source length, or would exceed kMaxPretenuringHints.
+  V8_EXPORT_PRIVATE bool SetPretenuringHints(DirectHandle<Script> script,
+                                             base::Vector<const uint8_t> data);
+
+  // Drops the registered hints of |script_id|.
+  void ClearPretenuringHints(int script_id);
+
+  // Drops the registered hints of scripts that have been collected. Called
+  // after each full GC, which is when scripts die.
+  void ClearStalePretenuringHints();
+
+  // Applies registered hints to the sites of the literal at |slot| in |vector|,
+  // given its newly created top-level allocation |site|.
+  void ApplyPretenuringHints(Tagged<FeedbackVector> vector, int slot,
+                             Tagged<AllocationSite> site);
+
  private:
+  // (function start position, literal slot, index of the site in the literal)
+  using PretenuringHint = std::tuple<int, int, int>;
+
+  // Upper bound for the number of registered hints of all scripts.
+  static constexpr size_t kMaxPretenuringHints = 64 * KB;
+
   Heap* const heap_;
 
   // The feedback storage is used to store allocation sites (keys) and how often
@@ -96,6 +140,10 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  // Pretenuring hints registered by the embedder, keyed by script id.
+  std::unordered_map<int, std::set<PretenuringHint>> pretenuring_hints_;
+  size_t pretenuring_hints_count_ = 0;
 };
 
 }  // namespace internal
@@ -4,6 +4,7 @@
 
 #include "src/heap/read-only-promotion.h"
 
+#include <map>
 #include <unordered_set>
 
 #include "src/codegen/external-reference-encoder.h"
@@ -425,6 +426,8 @@ class ReadOnlyPromotionImpl final : public AllStatic {
       Isolate* isolate, const std::vector<Tagged<HeapObject>>& promotees,
       HeapObjectMap* moves) {
     ReadOnlySpace* rospace = isolate->heap()->read_only_space();
+    // Number of objects and bytes promoted per instance type.
+    std::map<InstanceType, std::pair<size_t, size_t>> stats;
     for (Tagged<HeapObject> src : promotees) {
       const int size = src->Size(isolate);
       Tagged<HeapObject> dst =
@@ -432,10 +435,32 @@ class ReadOnlyPromotionImpl final : public AllStatic {
       Heap::CopyBlock(dst.address(), src.address(), size);
       moves->emplace(src, dst);
 
+      if (V8_UNLIKELY(v8_flags.trace_read_only_promotion)) {
+        auto& [count, bytes] = stats[src->map(isolate)->instance_type()];
+        count++;
+        bytes += size;
+      }
       if (V8_UNLIKELY(v8_flags.trace_read_only_promotion_verbose)) {
         LogPromotedObject(src, dst);
       }
     }
+    if (V8_UNLIKELY(v8_flags.trace_read_only_promotion)) {
+      LogPromotionStats(stats);
+    }
+  }
+
+  static void LogPromotionStats(
+      const std::map<InstanceType, std::pair<size_t, size_t>>& stats) {
+    size_t total_count = 0;
+    size_t total_bytes = 0;
+    for (const auto& [type, entry] : stats) {
+      std::cout << "ro-promotion: promoted " << entry.first << " objects ("
+                << entry.second << " bytes) of type " << type << "\n";
+      total_count += entry.first;
+      total_bytes += entry.second;
+    }
+    std::cout << "ro-promotion: promoted " << total_count << " objects ("
+              << total_bytes << " bytes) in total\n";
   }
 
   static void UpdatePointers(Isolate* isolate,
@@ -9,6 +9,7 @@
 
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles.h"
@@ -409,7 +410,20 @@ void GlobalSafepoint::EnterGlobalSafepointScope(Isolate* initiator) {
   // of all clients reached a safepoint.
   for (const PerClientSafepointData& client : clients) {
     DCHECK(client.is_locked());
+    base::TimeTicks start;
+    if (V8_UNLIKELY(v8_flags.trace_global_safepoint)) {
+      start = base::TimeTicks::Now();
+    }
     client.safepoint()->WaitUntilRunningThreadsInSafepoint(&client);
+    if (V8_UNLIKELY(v8_flags.trace_global_safepoint)) {
+      // Clients are waited for in order, so this is the additional time this
+      // client's threads needed after the previous clients stopped.
+      initiator->PrintWithTimestamp(
+          "Global safepoint: client isolate %p with %zu running threads "
+          "stopped after additional %.3f ms\n",
+          client.isolate(), client.running().size(),
+          (base::TimeTicks::Now() - start).InMillisecondsF());
+    }
   }
 }
 
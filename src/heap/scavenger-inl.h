@@ -322,9 +322,68 @@ SlotCallbackResult Scavenger::EvacuateInPlaceInternalizableString(
     return EvacuateObjectDefault<THeapObjectSlot, kPromoteIntoSharedHeap>(
         map, slot, object, object_size, object_fields);
   }
+  if (deduplicate_strings_ &&
+      map == ReadOnlyRoots(heap()).seq_one_byte_string_map() &&
+      heap()->semi_space_new_space()->ShouldBePromoted(object.address())) {
+    return EvacuateDeduplicatableString(map, slot,
+                                        UncheckedCast<SeqOneByteString>(object),
+                                        object_size, object_fields);
+  }
   return EvacuateObjectDefault(map, slot, object, object_size, object_fields);
 }
 
+template <typename THeapObjectSlot>
+SlotCallbackResult Scavenger::EvacuateDeduplicatableString(
+    Tagged<Map> map, THeapObjectSlot slot, Tagged<SeqOneByteString> object,
+    SafeHeapObjectSize object_size, ObjectFields object_fields) {
+  DCHECK(deduplicate_strings_);
+  DisallowGarbageCollection no_gc;
+  const uint32_t length = object->length();
+  // Strings may still be written to after allocation (e.g. by string
+  // builders), so only strings that already had their hash computed are
+  // considered. This also excludes strings with a forwarding index.
+  if (length > kMaxDeduplicatedStringLength ||
+      !Name::IsHash(object->raw_hash_field())) {
+    return EvacuateObjectDefault(map, slot, object, object_size,
+                                 object_fields);
+  }
+
+  const std::string_view chars(
+      reinterpret_cast<const char*>(object->GetChars(no_gc)), length);
+  auto it = deduplicated_strings_.find(chars);
+  if (it != deduplicated_strings_.end()) {
+    // An equal string was already promoted by this task. Forward |object| to
+    // it instead of promoting another copy.
+    Tagged<SeqOneByteString> canonical = it->second;
+    if (object->relaxed_compare_and_swap_map_word_forwarded(
+            MapWord::FromMap(map), canonical)) {
+      UpdateHeapObjectReferenceSlot(slot, canonical);
+      deduplicated_size_ += object_size.value();
+      return REMOVE_SLOT;
+    }
+    // Another task evacuated |object| in the meantime.
+    Tagged<HeapObject> target =
+        object->map_word(kRelaxedLoad).ToForwardingAddress(object);
+    UpdateHeapObjectReferenceSlot(slot, target);
+    SynchronizePageAccess(target);
+    return HeapLayout::InYoungGeneration(target) ? KEEP_SLOT : REMOVE_SLOT;
+  }
+
+  const SlotCallbackResult result =
+      EvacuateObjectDefault(map, slot, object, object_size, object_fields);
+  Tagged<HeapObject> target = (*slot).GetHeapObject();
+  if (!HeapLayout::InYoungGeneration(target)) {
+    // The promoted copy lives in old space and is not moved for the rest of
+    // this GC, so its characters can back the key of the table.
+    Tagged<SeqOneByteString> promoted = UncheckedCast<SeqOneByteString>(target);
+    deduplicated_strings_.emplace(
+        std::string_view(
+            reinterpret_cast<const char*>(promoted->GetChars(no_gc)), length),
+        promoted);
+  }
+  return result;
+}
+
 template <typename THeapObjectSlot>
 SlotCallbackResult Scavenger::EvacuateObject(THeapObjectSlot slot,
                                              Tagged<Map> map,
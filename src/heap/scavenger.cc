@@ -276,9 +276,13 @@ void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
   }
   if (V8_UNLIKELY(v8_flags.trace_parallel_scavenge)) {
     PrintIsolate(collector_->heap_->isolate(),
-                 "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
-                 static_cast<void*>(this), scavenging_time,
-                 scavenger->bytes_copied(), scavenger->bytes_promoted());
+                 "scavenge[%p]: task=%u time=%.2f copied=%zu promoted=%zu "
+                 "deduplicated=%zu stolen_segments=%zu\n",
+                 static_cast<void*>(this),
+                 static_cast<unsigned>(delegate->GetTaskId()),
+                 scavenging_time, scavenger->bytes_copied(),
+                 scavenger->bytes_promoted(), scavenger->bytes_deduplicated(),
+                 scavenger->segments_stolen());
   }
 }
 
@@ -989,6 +993,8 @@ void ScavengerCollector::CollectGarbage() {
 
     heap_->tracer()->SampleConcurrencyEsimate(
         FetchAndResetConcurrencyEstimate());
+    heap_->tracer()->SampleScavengerSegmentsStolen(
+        FetchAndResetSegmentsStolen());
   }
 
   {
@@ -1124,8 +1130,10 @@ int ScavengerCollector::NumberOfScavengeTasks() {
           MB +
       1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
-  int tasks = std::max(
-      1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
+  const int max_tasks =
+      std::clamp(v8_flags.scavenger_max_tasks.value(), 1, kMaxScavengerTasks);
+  int tasks =
+      std::max(1, std::min({num_scavenge_tasks, max_tasks, num_cores}));
   if (!heap_->CanPromoteYoungAndExpandOldGeneration(
           static_cast<size_t>(tasks * PageMetadata::kPageSize))) {
     // Optimize for memory usage near the heap limit.
@@ -1152,7 +1160,10 @@ Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
                            heap->isolate()->has_shared_space()),
       mark_shared_heap_(heap->isolate()->is_shared_space_isolate()),
       shortcut_strings_(
-          heap->CanShortcutStringsDuringGC(GarbageCollector::SCAVENGER)) {
+          heap->CanShortcutStringsDuringGC(GarbageCollector::SCAVENGER)),
+      deduplicate_strings_(v8_flags.scavenger_string_deduplication &&
+                           shortcut_strings_ && !shared_string_table_ &&
+                           !is_logging_) {
   DCHECK(!heap->incremental_marking()->IsMarking());
 }
 
@@ -1388,6 +1399,8 @@ void Scavenger::Finalize() {
   heap()->IncrementNewSpaceSurvivingObjectSize(copied_size_);
   heap()->IncrementPromotedObjectsSize(promoted_size_);
   collector_->MergeSurvivingNewLargeObjects(local_surviving_new_large_objects_);
+  collector_->segments_stolen_.fetch_add(segments_stolen(),
+                                         std::memory_order_relaxed);
   allocator_.Finalize();
   local_empty_chunks_.Publish();
   local_ephemeron_table_list_.Publish();
@@ -6,6 +6,8 @@
 #define V8_HEAP_SCAVENGER_H_
 
 #include <atomic>
+#include <string_view>
+#include <unordered_map>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/heap/base/worklist.h"
@@ -90,6 +92,13 @@ class Scavenger {
 
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
+  size_t bytes_deduplicated() const { return deduplicated_size_; }
+  // Number of worklist segments this scavenger took from the global pools
+  // after running out of local work.
+  size_t segments_stolen() const {
+    return local_copied_list_.SegmentsTakenFromGlobal() +
+           local_promoted_list_.SegmentsTakenFromGlobal();
+  }
 
  private:
   enum PromotionHeapChoice { kPromoteIntoLocalHeap, kPromoteIntoSharedHeap };
@@ -98,6 +107,10 @@ class Scavenger {
   // up other tasks.
   static const int kInterruptThreshold = 128;
 
+  // Longer strings are unlikely to be duplicated and are more expensive to
+  // compare.
+  static constexpr uint32_t kMaxDeduplicatedStringLength = 64;
+
   inline Heap* heap() { return heap_; }
 
   inline void SynchronizePageAccess(Tagged<MaybeObject> object) const;
@@ -187,6 +200,13 @@ class Scavenger {
       Tagged<Map> map, THeapObjectSlot slot, Tagged<String> string,
       SafeHeapObjectSize object_size, ObjectFields object_fields);
 
+  // Promotes |object| unless an equal string was already promoted by this
+  // scavenger, in which case |object| is forwarded to that string.
+  template <typename THeapObjectSlot>
+  inline SlotCallbackResult EvacuateDeduplicatableString(
+      Tagged<Map> map, THeapObjectSlot slot, Tagged<SeqOneByteString> object,
+      SafeHeapObjectSize object_size, ObjectFields object_fields);
+
   void IterateAndScavengePromotedObject(Tagged<HeapObject> target,
                                         Tagged<Map> map,
                                         SafeHeapObjectSize object_size);
@@ -211,12 +231,18 @@ class Scavenger {
   SurvivingNewLargeObjectsMap local_surviving_new_large_objects_;
   size_t copied_size_{0};
   size_t promoted_size_{0};
+  size_t deduplicated_size_{0};
   EvacuationAllocator allocator_;
+  // Promoted strings keyed by their characters, used for deduplicating
+  // strings on promotion. Local to each scavenger, so no locking is needed.
+  std::unordered_map<std::string_view, Tagged<SeqOneByteString>>
+      deduplicated_strings_;
 
   const bool is_logging_;
   const bool shared_string_table_;
   const bool mark_shared_heap_;
   const bool shortcut_strings_;
+  const bool deduplicate_strings_;
 
   friend class IterateAndScavengePromotedObjectsVisitor;
   friend class RootScavengeVisitor;
@@ -251,7 +277,8 @@ class ScavengerCollector {
   };
   using PinnedObjects = std::vector<PinnedObjectEntry>;
 
-  static const int kMaxScavengerTasks = 8;
+  // Upper bound for --scavenger-max-tasks.
+  static const int kMaxScavengerTasks = 64;
   static const int kMainThreadId = 0;
 
   explicit ScavengerCollector(Heap* heap);
@@ -378,6 +405,10 @@ class ScavengerCollector {
 
   void SweepArrayBufferExtensions();
 
+  size_t FetchAndResetSegmentsStolen() {
+    return segments_stolen_.exchange(0, std::memory_order_relaxed);
+  }
+
   size_t FetchAndResetConcurrencyEstimate() {
     const size_t estimate =
         estimate_concurrency_.exchange(0, std::memory_order_relaxed);
@@ -388,6 +419,7 @@ class ScavengerCollector {
   Heap* const heap_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
   std::atomic<size_t> estimate_concurrency_{0};
+  std::atomic<size_t> segments_stolen_{0};
   QuarantinedPageSweeper quarantined_page_sweeper_;
 
   friend class Scavenger;
@@ -113,6 +113,14 @@ class Sweeper::MajorSweeperJob final : public JobTask {
 
  public:
   static constexpr int kMaxTasks = kNumberOfMajorSweepingSpaces;
+  // With --parallel-major-sweeping, tasks beyond the number of spaces start on
+  // a space that is already being swept, so that large spaces (e.g. a shared
+  // space with many pages) are swept by multiple tasks in parallel.
+  static constexpr int kMaxParallelTasks = 4 * kNumberOfMajorSweepingSpaces;
+
+  static int MaxTasks() {
+    return v8_flags.parallel_major_sweeping ? kMaxParallelTasks : kMaxTasks;
+  }
 
   MajorSweeperJob(Isolate* isolate, Sweeper* sweeper)
       : sweeper_(sweeper),
@@ -120,7 +128,7 @@ class Sweeper::MajorSweeperJob final : public JobTask {
             sweeper_->major_sweeping_state_.concurrent_sweepers()),
         tracer_(isolate->heap()->tracer()),
         trace_id_(sweeper_->major_sweeping_state_.background_trace_id()) {
-    DCHECK_LE(concurrent_sweepers.size(), kMaxTasks);
+    DCHECK_LE(concurrent_sweepers.size(), MaxTasks());
   }
 
   ~MajorSweeperJob() override = default;
@@ -185,6 +193,8 @@ class Sweeper::MinorSweeperJob final : public JobTask {
  public:
   static constexpr int kMaxTasks = 1;
 
+  static int MaxTasks() { return kMaxTasks; }
+
   MinorSweeperJob(Isolate* isolate, Sweeper* sweeper)
       : sweeper_(sweeper),
         concurrent_sweepers(
@@ -316,7 +326,7 @@ void Sweeper::SweepingState<scope>::StartConcurrentSweeping() {
                        background_trace_id(), TRACE_EVENT_FLAG_FLOW_OUT);
     DCHECK_IMPLIES(v8_flags.minor_ms, concurrent_sweepers_.empty());
     int max_concurrent_sweeper_count =
-        std::min(SweeperJob::kMaxTasks,
+        std::min(SweeperJob::MaxTasks(),
                  V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
     if (concurrent_sweepers_.empty()) {
       for (int i = 0; i < max_concurrent_sweeper_count; ++i) {
@@ -869,11 +879,17 @@ void Sweeper::FinishMajorJobs() {
         is_main_thread ? ThreadKind::kMain : ThreadKind::kBackground,
         major_sweeping_state_.trace_id(),
         TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
-    ForAllSweepingSpaces([this](AllocationSpace space) {
-      if (space == NEW_SPACE) return;
-      main_thread_local_sweeper_.ParallelSweepSpace(
-          space, SweepingMode::kLazyOrConcurrent);
-    });
+    // With parallel major sweeping the main thread contributes by joining the
+    // job below, which lets it help with whichever space still has the most
+    // work instead of sweeping all spaces in order.
+    if (!v8_flags.parallel_major_sweeping ||
+        !major_sweeping_state_.HasValidJob()) {
+      ForAllSweepingSpaces([this](AllocationSpace space) {
+        if (space == NEW_SPACE) return;
+        main_thread_local_sweeper_.ParallelSweepSpace(
+            space, SweepingMode::kLazyOrConcurrent);
+      });
+    }
   }
 
   // Join all concurrent tasks.
@@ -3145,6 +3145,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   BIND(&try_secondary);
   {
     // Probe the secondary table.
+    IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1);
     TNode<IntPtrT> secondary_offset =
         StubCacheSecondaryOffset(name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
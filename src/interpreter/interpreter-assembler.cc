@@ -1282,6 +1282,55 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  TNode<Int32T> target_bytecode32 = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(target_bytecode32,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(Word32Equal(target_bytecode32,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  // As for short Star lookahead, both inlined jumps dispatch on their own
+  // rather than merging control flow, for better branch prediction.
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<Boolean> value) {
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  // Dispatch() has already advanced BytecodeOffset() to the jump, so its
+  // operand can be read as if we were in the jump's own handler.
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator, value, 0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1294,6 +1343,8 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
     TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
   }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
@@ -448,6 +448,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including the subsequent dispatch on both paths. Anything after this
+  // point can assume that the following instruction was neither of these.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| (JumpIfTrue or JumpIfFalse) at the current
+  // BytecodeOffset(), jumping if the accumulator is |value|.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Boolean> value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
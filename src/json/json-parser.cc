@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "hwy/highway.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
@@ -334,6 +335,11 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source,
   }
   cursor_ = chars_ + start;
   end_ = cursor_ + length;
+
+  allocation_ = v8_flags.json_parse_pretenure_threshold > 0 &&
+                        length >= v8_flags.json_parse_pretenure_threshold
+                    ? AllocationType::kOld
+                    : AllocationType::kYoung;
 }
 
 template <typename Char>
@@ -571,12 +577,78 @@ JsonToken GetTokenForCharacter(Char c) {
   return V8_LIKELY(c <= unibrow::Latin1::kMaxChar) ? one_char_json_tokens[c]
                                                    : JsonToken::ILLEGAL;
 }
+
+// Skips 16-byte blocks that consist only of JSON whitespace. Returns the
+// position of the first non-whitespace character, or the start of the
+// trailing partial block, which the caller needs to scan itself.
+const uint8_t* SkipJsonWhitespaceSIMD(const uint8_t* cursor,
+                                      const uint8_t* end) {
+  namespace hw = hwy::HWY_NAMESPACE;
+
+  hw::FixedTag<uint8_t, 16> tag;
+  static constexpr size_t stride = hw::Lanes(tag);
+
+  const auto mask_space = hw::Set(tag, ' ');
+  const auto mask_tab = hw::Set(tag, '\t');
+  const auto mask_new_line = hw::Set(tag, '\n');
+  const auto mask_carriage_return = hw::Set(tag, '\r');
+
+  for (; cursor + (stride - 1) < end; cursor += stride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto is_whitespace =
+        hw::Or(hw::Or(input == mask_space, input == mask_tab),
+               hw::Or(input == mask_new_line, input == mask_carriage_return));
+    const auto result = hw::Not(is_whitespace);
+    if (!hw::AllFalse(tag, result)) {
+      return cursor + hw::FindKnownFirstTrue(tag, result);
+    }
+  }
+  return cursor;
+}
+
+// Skips 16-byte blocks that don't contain characters which may terminate a
+// JSON string, i.e. '"', '\\' and control characters. Returns the position of
+// the first such character, or the start of the trailing partial block, which
+// the caller needs to scan itself.
+const uint8_t* SkipJsonStringCharactersSIMD(const uint8_t* cursor,
+                                            const uint8_t* end) {
+  namespace hw = hwy::HWY_NAMESPACE;
+
+  hw::FixedTag<uint8_t, 16> tag;
+  static constexpr size_t stride = hw::Lanes(tag);
+
+  const auto mask_0x20 = hw::Set(tag, 0x20);
+  const auto mask_0x22 = hw::Set(tag, 0x22);
+  const auto mask_0x5c = hw::Set(tag, 0x5c);
+
+  for (; cursor + (stride - 1) < end; cursor += stride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto has_lower_than_0x20 = input < mask_0x20;
+    const auto has_0x22 = input == mask_0x22;
+    const auto has_0x5c = input == mask_0x5c;
+    const auto result = hw::Or(hw::Or(has_lower_than_0x20, has_0x22), has_0x5c);
+    if (V8_UNLIKELY(!hw::AllFalse(tag, result))) {
+      return cursor + hw::FindKnownFirstTrue(tag, result);
+    }
+  }
+  return cursor;
+}
 }  // namespace
 
 template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  if constexpr (sizeof(Char) == 1) {
+    // Only use the vectorized path for runs of whitespace (e.g. indentation
+    // in pretty-printed input); single separators are cheaper to scan.
+    if (end_ - cursor_ >= 2 &&
+        one_char_json_tokens[cursor_[0]] == JsonToken::WHITESPACE &&
+        one_char_json_tokens[cursor_[1]] == JsonToken::WHITESPACE) {
+      cursor_ = SkipJsonWhitespaceSIMD(cursor_, end_);
+    }
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -651,10 +723,11 @@ class FoldedMutableHeapNumberAllocation {
   // padding fillers between heap numbers.
   static_assert(!USE_ALLOCATION_ALIGNMENT_HEAP_NUMBER_BOOL);
 
-  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count) {
+  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count,
+                                    AllocationType allocation) {
     if (count == 0) return;
     int size = count * sizeof(HeapNumber);
-    raw_bytes_ = isolate->factory()->NewByteArray(size);
+    raw_bytes_ = isolate->factory()->NewByteArray(size, allocation);
   }
 
   Handle<ByteArray> raw_bytes() const { return raw_bytes_; }
@@ -755,8 +828,10 @@ class JSDataObjectBuilder {
   JSDataObjectBuilder(Isolate* isolate, ElementsKind elements_kind,
                       int expected_named_properties,
                       DirectHandle<Map> expected_final_map,
-                      HeapNumberMode heap_number_mode)
+                      HeapNumberMode heap_number_mode,
+                      AllocationType allocation = AllocationType::kYoung)
       : isolate_(isolate),
+        allocation_(allocation),
         elements_kind_(elements_kind),
         expected_property_count_(expected_named_properties),
         heap_number_mode_(heap_number_mode),
@@ -916,7 +991,7 @@ class JSDataObjectBuilder {
       DCHECK_EQ(current_property_index_, 0);
 
       Handle<JSObject> object = isolate_->factory()->NewSlowJSObjectFromMap(
-          map_, expected_property_count_);
+          map_, expected_property_count_, allocation_);
       object->set_elements(*elements);
       object_ = object;
       return;
@@ -934,12 +1009,13 @@ class JSDataObjectBuilder {
     // object -- this ensures that there is no allocation between the object
     // allocation and its initial fields being initialised, where the verifier
     // would see invalid double field state.
-    FoldedMutableHeapNumberAllocation hn_allocation(isolate_,
-                                                    extra_heap_numbers_needed_);
+    FoldedMutableHeapNumberAllocation hn_allocation(
+        isolate_, extra_heap_numbers_needed_, allocation_);
 
     // Allocate the object then immediately start a no_gc scope -- again, this
     // is so the verifier doesn't see invalid double field state.
-    Handle<JSObject> object = isolate_->factory()->NewJSObjectFromMap(map_);
+    Handle<JSObject> object =
+        isolate_->factory()->NewJSObjectFromMap(map_, allocation_);
     DisallowGarbageCollection no_gc;
     Tagged<JSObject> raw_object = *object;
 
@@ -1204,6 +1280,7 @@ class JSDataObjectBuilder {
   V8_INLINE void AdvanceToNextProperty() { current_property_index_++; }
 
   Isolate* isolate_;
+  const AllocationType allocation_;
   ElementsKind elements_kind_;
   int expected_property_count_;
   HeapNumberMode heap_number_mode_;
@@ -1330,7 +1407,7 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       elements = elms;
     } else {
       Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+          factory()->NewFixedArrayWithHoles(cont.max_index + 1, allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> raw_elements = *elms;
       WriteBarrierModeScope mode = raw_elements->GetWriteBarrierMode(no_gc);
@@ -1356,7 +1433,8 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       isolate_, elements_kind, named_length, feedback,
       should_track_json_source
           ? JSDataObjectBuilder::kNormalHeapNumbers
-          : JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned);
+          : JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned,
+      allocation_);
 
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
@@ -1381,7 +1459,9 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array = factory()->NewJSArray(
+      kind, length, length,
+      ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS, allocation_);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowGarbageCollection no_gc;
     Tagged<FixedDoubleArray> elements =
@@ -1543,6 +1623,33 @@ const uint8_t* GetFastKeyChars(Isolate* isolate, Tagged<String> key,
 
 }  // namespace
 
+template <typename Char>
+bool JsonParser<Char>::NextObjectMatchesFeedback(Tagged<Map> feedback) {
+  DisallowGarbageCollection no_gc;
+  Tagged<DescriptorArray> descriptors = feedback->instance_descriptors();
+  if (descriptors->number_of_descriptors() == 0 ||
+      descriptors->fast_iterable() !=
+          DescriptorArray::FastIterableState::kJsonFast) {
+    return false;
+  }
+  auto is_whitespace = [](Char c) {
+    return GetTokenForCharacter(c) == JsonToken::WHITESPACE;
+  };
+  const Char* cursor = std::find_if_not(cursor_, end_, is_whitespace);
+  if (cursor == end_ || *cursor != '{') return false;
+  cursor = std::find_if_not(cursor + 1, end_, is_whitespace);
+  if (cursor == end_ || *cursor != '"') return false;
+  cursor++;
+  // Fast iterable keys are guaranteed to be 1-byte.
+  Tagged<String> key = Cast<String>(descriptors->GetKey(InternalIndex(0)));
+  const uint32_t key_length = key->length();
+  const uint8_t* key_chars =
+      GetFastKeyChars(isolate_, key, key->map(), no_gc);
+  return key_length < static_cast<size_t>(end_ - cursor) &&
+         cursor[key_length] == '"' &&
+         CompareCharsEqual(key_chars, cursor, key_length);
+}
+
 template <typename Char>
 template <DescriptorArray::FastIterableState fast_iterable_state>
 bool JsonParser<Char>::ParseJsonObjectProperties(
@@ -1790,14 +1897,20 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
         static_cast<int>(smi_elements_.size() + double_elements_.size());
     Handle<JSArray> array;
     if (!saw_double) {
-      array = factory()->NewJSArray(PACKED_SMI_ELEMENTS, length, length);
+      array = factory()->NewJSArray(
+          PACKED_SMI_ELEMENTS, length, length,
+          ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS,
+          allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
       for (int i = 0; i < length; i++) {
         elements->set(i, Smi::FromInt(smi_elements_[i]));
       }
     } else {
-      array = factory()->NewJSArray(PACKED_DOUBLE_ELEMENTS, length, length);
+      array = factory()->NewJSArray(
+          PACKED_DOUBLE_ELEMENTS, length, length,
+          ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS,
+          allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedDoubleArray> elements =
           Cast<FixedDoubleArray>(array->elements());
@@ -1828,6 +1941,14 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
   Handle<Object> value;
   if (V8_UNLIKELY(!ParseJsonValueRecursive().ToHandle(&value))) return {};
   element_stack_.emplace_back(value);
+  // Distinct maps of recently parsed sibling objects. The previous sibling's
+  // map is used as feedback for the next element. If the next object starts
+  // with a different key, an earlier sibling's map that matches is used
+  // instead, so that arrays of records with briefly diverging shapes keep
+  // hitting the fast path.
+  static constexpr size_t kMaxSiblingShapes = 4;
+  base::SmallVector<Handle<Map>, kMaxSiblingShapes> sibling_shapes;
+  size_t next_sibling_shape = 0;
   while (Check(JsonToken::COMMA)) {
     Handle<Map> feedback;
     if (IsJSObject(*value)) {
@@ -1836,6 +1957,26 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
       // from the transition tree.
       if (!maybe_feedback->IsDetached(isolate_)) {
         feedback = handle(maybe_feedback, isolate_);
+        if (std::none_of(sibling_shapes.begin(), sibling_shapes.end(),
+                         [&](Handle<Map> shape) {
+                           return *shape == maybe_feedback;
+                         })) {
+          if (sibling_shapes.size() < kMaxSiblingShapes) {
+            sibling_shapes.emplace_back(feedback);
+          } else {
+            sibling_shapes[next_sibling_shape] = feedback;
+            next_sibling_shape = (next_sibling_shape + 1) % kMaxSiblingShapes;
+          }
+        }
+      }
+    }
+    if (sibling_shapes.size() > 1 &&
+        (feedback.is_null() || !NextObjectMatchesFeedback(*feedback))) {
+      for (Handle<Map> shape : sibling_shapes) {
+        if (NextObjectMatchesFeedback(*shape)) {
+          feedback = shape;
+          break;
+        }
       }
     }
     if (V8_UNLIKELY(!ParseJsonValueRecursive(feedback).ToHandle(&value))) {
@@ -2189,6 +2330,9 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
   double double_number;
   int smi_number;
   if (ParseJsonNumberAsDoubleOrSmi(&double_number, &smi_number)) {
+    if (allocation_ == AllocationType::kOld) {
+      return factory()->NewHeapNumber<AllocationType::kOld>(double_number);
+    }
     return factory()->NewHeapNumber(double_number);
   }
   return handle(Smi::FromInt(smi_number), isolate_);
@@ -2364,12 +2508,16 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), allocation_)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), allocation_)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
@@ -2456,6 +2604,9 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = SkipJsonStringCharactersSIMD(cursor_, end_);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
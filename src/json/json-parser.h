@@ -348,6 +348,9 @@ class JsonParser final {
   V8_INLINE bool FastKeyMatch(const uint8_t* key_chars, uint32_t key_length);
   V8_INLINE bool FastKeyMatch(const uint8_t* key_chars, uint32_t key_length,
                               JsonString scanned_key);
+  // Returns true if the upcoming value is an object whose first key matches
+  // the first property of the fast iterable map |feedback|.
+  bool NextObjectMatchesFeedback(Tagged<Map> feedback);
 
   template <bool should_track_json_source>
   Handle<JSObject> BuildJsonObject(const JsonContinuation& cont,
@@ -419,6 +422,10 @@ class JsonParser final {
   JsonToken next_;
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
+  // Large inputs produce large, long-lived object graphs, which are allocated
+  // directly in old space to avoid copying them in scavenges during and after
+  // parsing.
+  AllocationType allocation_;
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
   Handle<String> source_;
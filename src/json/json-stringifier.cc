@@ -25,6 +25,7 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -1867,6 +1868,22 @@ class OutBuffer {
       CopyChars(dst, stack_buffer_, StackBufferLength());
     }
   }
+  // Calls |callback| with (chars, length) for each filled part of the buffer,
+  // in order.
+  template <typename Callback>
+  void ForEachSegment(Callback callback) const {
+    if (ZoneUsed()) {
+      callback(stack_buffer_, stack_buffer_size_);
+      DCHECK_GT(segments_->length(), 0);
+      for (int i = 0; i < segments_->length() - 1; i++) {
+        base::Vector<Char> segment = segments_.value()[i];
+        callback(segment.begin(), segment.size());
+      }
+      callback(segments_->last().begin(), CurSegmentLength());
+    } else {
+      callback(stack_buffer_, StackBufferLength());
+    }
+  }
 
  private:
   static constexpr uint32_t kInitialSegmentSize = 2 * KB;
@@ -2167,6 +2184,10 @@ class FastJsonStringifier {
   void CopyResultTo(DstChar* out_buffer) {
     buffer_.CopyTo(out_buffer);
   }
+  template <typename Callback>
+  void ForEachResultSegment(Callback callback) const {
+    buffer_.ForEachSegment(callback);
+  }
   V8_INLINE FastJsonStringifierResult
   SerializeObject(Tagged<JSAny> object, const DisallowGarbageCollection& no_gc);
 
@@ -3566,8 +3587,133 @@ MaybeDirectHandle<Object> FastJsonStringify(Isolate* isolate,
   return MaybeDirectHandle<Object>();
 }
 
+// Encodes the stringifier output as UTF-8 and forwards it to the embedder's
+// sink in chunks of at most kBufferSize bytes.
+class Utf8OutputSinkWriter {
+ public:
+  explicit Utf8OutputSinkWriter(v8::JSON::OutputSink* sink) : sink_(sink) {}
+  ~Utf8OutputSinkWriter() { Flush(); }
+
+  void Write(const uint8_t* chars, size_t length) {
+    while (length > 0) {
+      if (V8_UNLIKELY(kBufferSize - used_ <
+                      unibrow::Utf8::kMax8BitCodeUnitSize)) {
+        Flush();
+      }
+      if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+        used_ += unibrow::Utf8::EncodeOneByte(buffer_ + used_, *chars);
+        chars++;
+        length--;
+        continue;
+      }
+      // Copy runs of ASCII characters directly.
+      const size_t max_run = std::min(length, kBufferSize - used_);
+      size_t run = 1;
+      while (run < max_run && chars[run] <= unibrow::Utf8::kMaxOneByteChar) {
+        run++;
+      }
+      MemCopy(buffer_ + used_, chars, run);
+      used_ += run;
+      chars += run;
+      length -= run;
+    }
+    previous_ = unibrow::Utf16::kNoPreviousCharacter;
+  }
+
+  void Write(const base::uc16* chars, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+      // Encoding the trailing half of a surrogate pair rewrites the bytes
+      // emitted for the leading half, so never flush in between.
+      if (kBufferSize - used_ < 2 * unibrow::Utf8::kMaxEncodedSize &&
+          !unibrow::Utf16::IsLeadSurrogate(previous_)) {
+        Flush();
+      }
+      base::uc16 c = chars[i];
+      used_ += unibrow::Utf8::Encode(buffer_ + used_, c, previous_, true);
+      previous_ = c;
+    }
+  }
+
+ private:
+  static constexpr size_t kBufferSize = 8 * KB;
+
+  void Flush() {
+    if (used_ == 0) return;
+    sink_->Write(buffer_, used_);
+    used_ = 0;
+  }
+
+  v8::JSON::OutputSink* const sink_;
+  char buffer_[kBufferSize];
+  size_t used_ = 0;
+  int previous_ = unibrow::Utf16::kNoPreviousCharacter;
+};
+
+void WriteStringToUtf8Sink(Isolate* isolate, DirectHandle<String> string,
+                           v8::JSON::OutputSink* sink) {
+  string = String::Flatten(isolate, string);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = string->GetFlatContent(no_gc);
+  Utf8OutputSinkWriter writer(sink);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    writer.Write(chars.begin(), chars.size());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    writer.Write(chars.begin(), chars.size());
+  }
+}
+
 }  // namespace
 
+Maybe<bool> JsonStringifyToUtf8(Isolate* isolate, Handle<JSAny> object,
+                                v8::JSON::OutputSink* sink) {
+  Handle<JSAny> undefined = isolate->factory()->undefined_value();
+  if (CanUseFastStringifier(undefined, undefined)) {
+    DisallowGarbageCollection no_gc;
+    FastJsonStringifier<uint8_t> one_byte_stringifier(isolate);
+    std::optional<FastJsonStringifier<base::uc16>> two_byte_stringifier;
+    FastJsonStringifierResult result =
+        one_byte_stringifier.SerializeObject(*object, no_gc);
+    if (result == CHANGE_ENCODING) {
+      two_byte_stringifier.emplace(isolate);
+      result = two_byte_stringifier->ResumeFrom(one_byte_stringifier, no_gc);
+      DCHECK_NE(result, CHANGE_ENCODING);
+    }
+    if (V8_LIKELY(result == SUCCESS)) {
+      // Transcode the output segments directly, without materializing an
+      // intermediate string on the heap.
+      Utf8OutputSinkWriter writer(sink);
+      one_byte_stringifier.ForEachResultSegment(
+          [&](const uint8_t* chars, size_t length) {
+            writer.Write(chars, length);
+          });
+      if (two_byte_stringifier.has_value()) {
+        two_byte_stringifier->ForEachResultSegment(
+            [&](const base::uc16* chars, size_t length) {
+              writer.Write(chars, length);
+            });
+      }
+      return Just(true);
+    } else if (result == UNDEFINED) {
+      return Just(false);
+    } else if (result == EXCEPTION) {
+      CHECK(isolate->has_exception());
+      return Nothing<bool>();
+    }
+    DCHECK_EQ(result, SLOW_PATH);
+  }
+
+  JsonStringifier stringifier(isolate);
+  DirectHandle<Object> result;
+  if (!stringifier.Stringify(object, undefined, undefined).ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  if (IsUndefined(*result, isolate)) return Just(false);
+  WriteStringToUtf8Sink(isolate, Cast<String>(result), sink);
+  return Just(true);
+}
+
 MaybeDirectHandle<Object> JsonStringify(Isolate* isolate, Handle<JSAny> object,
                                         Handle<JSAny> replacer,
                                         Handle<Object> gap) {
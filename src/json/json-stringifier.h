@@ -5,6 +5,7 @@
 #ifndef V8_JSON_JSON_STRINGIFIER_H_
 #define V8_JSON_JSON_STRINGIFIER_H_
 
+#include "include/v8-json.h"
 #include "src/objects/objects.h"
 
 namespace v8 {
@@ -13,6 +14,13 @@ namespace internal {
 V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> JsonStringify(
     Isolate* isolate, Handle<JSAny> object, Handle<JSAny> replacer,
     Handle<Object> gap);
+
+// Serializes |object| like JsonStringify without replacer and gap, but writes
+// the UTF-8 encoded result to |sink| instead of creating a string. Returns
+// false if the value is not serializable, i.e. JsonStringify would return
+// undefined.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToUtf8(
+    Isolate* isolate, Handle<JSAny> object, v8::JSON::OutputSink* sink);
 }  // namespace internal
 }  // namespace v8
 
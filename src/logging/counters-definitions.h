@@ -387,6 +387,9 @@ namespace internal {
   SC(write_barriers, V8.WriteBarriers)                                    \
   SC(regexp_entry_native, V8.RegExpEntryNative)                           \
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)        \
+  /* Number of probes that missed in the primary table. */                \
+  SC(megamorphic_stub_cache_secondary_probes,                             \
+     V8.MegamorphicStubCacheSecondaryProbes)                              \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)        \
   SC(number_string_cache_smi_probes, V8.NumberStringCacheSmiProbes)       \
   SC(number_string_cache_smi_misses, V8.NumberStringCacheSmiMisses)       \
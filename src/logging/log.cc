@@ -119,6 +119,21 @@ v8::CodeEventType GetCodeEventTypeForTag(LogEventListener::CodeTag tag) {
   UNREACHABLE();
 }
 
+v8::CodeEventTier GetCodeEventTierForKind(CodeKind kind) {
+  switch (kind) {
+    case CodeKind::INTERPRETED_FUNCTION:
+      return v8::CodeEventTier::kInterpreter;
+    case CodeKind::BASELINE:
+      return v8::CodeEventTier::kBaseline;
+    case CodeKind::MAGLEV:
+      return v8::CodeEventTier::kMaglev;
+    case CodeKind::TURBOFAN_JS:
+      return v8::CodeEventTier::kTurbofan;
+    default:
+      return v8::CodeEventTier::kUnknown;
+  }
+}
+
 #define CALL_CODE_EVENT_HANDLER(Call) \
   if (listener_) {                    \
     listener_->Call;                  \
@@ -531,6 +546,7 @@ void ExternalLogEventListener::CodeCreateEvent(CodeTag tag,
   code_event.script_line = 0;
   code_event.script_column = 0;
   code_event.code_type = GetCodeEventTypeForTag(tag);
+  code_event.code_tier = GetCodeEventTierForKind(code->kind(cage_base));
   code_event.comment = comment;
 
   code_event_handler_->Handle(reinterpret_cast<v8::CodeEvent*>(&code_event));
@@ -552,6 +568,7 @@ void ExternalLogEventListener::CodeCreateEvent(CodeTag tag,
   code_event.script_line = 0;
   code_event.script_column = 0;
   code_event.code_type = GetCodeEventTypeForTag(tag);
+  code_event.code_tier = GetCodeEventTierForKind(code->kind(cage_base));
   code_event.comment = "";
 
   code_event_handler_->Handle(reinterpret_cast<v8::CodeEvent*>(&code_event));
@@ -573,6 +590,7 @@ void ExternalLogEventListener::CodeCreateEvent(
   code_event.script_line = 0;
   code_event.script_column = 0;
   code_event.code_type = GetCodeEventTypeForTag(tag);
+  code_event.code_tier = GetCodeEventTierForKind(code->kind(cage_base));
   code_event.comment = "";
 
   code_event_handler_->Handle(reinterpret_cast<v8::CodeEvent*>(&code_event));
@@ -598,6 +616,7 @@ void ExternalLogEventListener::CodeCreateEvent(
   code_event.script_line = line;
   code_event.script_column = column;
   code_event.code_type = GetCodeEventTypeForTag(tag);
+  code_event.code_tier = GetCodeEventTierForKind(code->kind(cage_base));
   code_event.comment = "";
 
   code_event_handler_->Handle(reinterpret_cast<v8::CodeEvent*>(&code_event));
@@ -627,6 +646,7 @@ void ExternalLogEventListener::RegExpCodeCreateEvent(
   code_event.script_column = 0;
   code_event.code_type =
       GetCodeEventTypeForTag(LogEventListener::CodeTag::kRegExp);
+  code_event.code_tier = v8::CodeEventTier::kUnknown;
   code_event.comment = "";
 
   code_event_handler_->Handle(reinterpret_cast<v8::CodeEvent*>(&code_event));
@@ -646,6 +666,7 @@ void InitializeCodeEvent(Isolate* isolate, CodeEvent* event,
   event->script_line = 0;
   event->script_column = 0;
   event->code_type = v8::CodeEventType::kRelocationType;
+  event->code_tier = v8::CodeEventTier::kUnknown;
   event->comment = "";
 }
 
@@ -495,6 +495,7 @@ struct CodeEvent {
   CodeEventType code_type;
   const char* comment;
   uintptr_t previous_code_start_address;
+  CodeEventTier code_tier;
 };
 
 class ExternalLogEventListener : public LogEventListener {
@@ -172,12 +172,14 @@ namespace v8::internal {
   V(SharedArrayBuffer_New)                                 \
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
+  V(String_NewExternalFromUtf8)                            \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
   V(String_NewFromUtf8Literal)                             \
+  V(String_Utf8StreamDecoder_Finish)                       \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
@@ -5672,9 +5672,11 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
 
     // TODO(v8:12547): Support writing to objects in shared space, which
     // need a write barrier that calls Object::Share to ensure the RHS is
-    // shared.
+    // shared. Smis never need to be shared, so they can already be stored
+    // like into any other object.
     if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(map.instance_type()) &&
-        access_mode == compiler::AccessMode::kStore) {
+        access_mode == compiler::AccessMode::kStore &&
+        !CheckType(GetAccumulator(), NodeType::kSmi)) {
       return {};
     }
 
@@ -8977,18 +8979,18 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratorPrototypeNext(
       iterator->get(JSArrayIterator::kIteratedObjectOffset);
   ElementsKind elements_kind;
   base::SmallVector<compiler::MapRef, 4> maps;
-  if (iterated_object->Is<InlinedAllocation>()) {
+  // Inside a loop, the map of the iterated object could be changed by a later
+  // part of the loop body, so the map of the virtual object cannot be trusted.
+  // Rely on the known node aspects instead, which keep stable maps across
+  // loop headers. This keeps the iterator and its result objects elidable in
+  // the common `for-of` loop.
+  if (iterated_object->Is<InlinedAllocation>() && !IsInsideLoop()) {
     VirtualObject* array = iterated_object->Cast<InlinedAllocation>()->object();
     // TODO(victorgomes): Remove this once we track changes in the inlined
     // allocated object.
     if (iterated_object->Cast<InlinedAllocation>()->IsEscaping()) {
       FAIL("allocation is escaping, map could have been changed");
     }
-    // TODO(victorgomes): This effectively disable the optimization for `for-of`
-    // loops. We need to figure it out a way to re-enable this.
-    if (IsInsideLoop()) {
-      FAIL("we're inside a loop, iterated object map could change");
-    }
     auto map = array->map();
     if (!map.supports_fast_array_iteration(broker())) {
       FAIL("no fast array iteration support");
@@ -10073,6 +10075,48 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceMapPrototypeGet(
   return entry;
 }
 
+MaybeReduceResult MaglevGraphBuilder::TryReduceMapPrototypeHas(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (!CanSpeculateCall()) return {};
+  if (!is_turbolev()) {
+    // See the comment in TryReduceMapPrototypeGet.
+    return {};
+  }
+
+  if (args.receiver_mode() == ConvertReceiverMode::kNullOrUndefined) {
+    FAIL(" to reduce Map.prototype.has - no receiver");
+  }
+  if (args.count() != 1) {
+    FAIL(" to reduce Map.prototype.has - invalid argument count");
+  }
+
+  ValueNode* receiver = GetValueOrUndefined(args.receiver());
+  auto possible_receiver_maps =
+      known_node_aspects().TryGetPossibleMaps(receiver);
+  if (!possible_receiver_maps) {
+    FAIL(" to reduce Map.prototype.has - unknown receiver map");
+  }
+
+  // See the comment in TryReduceMapPrototypeGet.
+  if (possible_receiver_maps->is_empty()) {
+    return ReduceResult::DoneWithAbort();
+  }
+
+  if (!AllOfInstanceTypesAre(*possible_receiver_maps, JS_MAP_TYPE)) {
+    FAIL(" to reduce Map.prototype.has - wrong receiver maps");
+  }
+
+  ValueNode* key = args[0];
+  ValueNode* table = BuildLoadTaggedField(receiver, JSCollection::kTableOffset);
+
+  auto key_info = known_node_aspects().TryGetInfoFor(key);
+  if (key_info && key_info->alternative().int32()) {
+    return AddNewNode<MapPrototypeHasInt32Key>(
+        {table, key_info->alternative().int32()});
+  }
+  return AddNewNode<MapPrototypeHas>({table, key});
+}
+
 MaybeReduceResult MaglevGraphBuilder::TryReduceSetPrototypeHas(
     compiler::JSFunctionRef target, CallArguments& args) {
   if (!CanSpeculateCall()) return {};
@@ -935,6 +935,7 @@ class MaglevGraphBuilder {
   V(FunctionPrototypeCall)                     \
   V(FunctionPrototypeHasInstance)              \
   V(MapPrototypeGet)                           \
+  V(MapPrototypeHas)                           \
   V(ObjectPrototypeGetProto)                   \
   V(ObjectGetPrototypeOf)                      \
   V(ReflectGetPrototypeOf)                     \
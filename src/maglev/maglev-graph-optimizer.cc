@@ -1676,6 +1676,16 @@ ProcessResult MaglevGraphOptimizer::VisitMapPrototypeGetInt32Key() {
   return ProcessResult::kContinue;
 }
 
+ProcessResult MaglevGraphOptimizer::VisitMapPrototypeHas() {
+  // TODO(b/424157317): Optimize.
+  return ProcessResult::kContinue;
+}
+
+ProcessResult MaglevGraphOptimizer::VisitMapPrototypeHasInt32Key() {
+  // TODO(b/424157317): Optimize.
+  return ProcessResult::kContinue;
+}
+
 ProcessResult MaglevGraphOptimizer::VisitSetPrototypeHas() {
   // TODO(b/424157317): Optimize.
   return ProcessResult::kContinue;
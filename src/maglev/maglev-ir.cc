@@ -642,6 +642,8 @@ NodeType ValueNode::GetStaticType(compiler::JSHeapBroker* broker) {
     case Opcode::kToBoolean:
     case Opcode::kToBooleanLogicalNot:
     case Opcode::kIntPtrToBoolean:
+    case Opcode::kMapPrototypeHas:
+    case Opcode::kMapPrototypeHasInt32Key:
     case Opcode::kSetPrototypeHas:
       return NodeType::kBoolean;
     case Opcode::kCreateFunctionContext:
@@ -173,6 +173,8 @@ class ExceptionHandlerInfo;
   V(NewConsString)                  \
   V(MapPrototypeGet)                \
   V(MapPrototypeGetInt32Key)        \
+  V(MapPrototypeHas)                \
+  V(MapPrototypeHasInt32Key)        \
   V(SetPrototypeHas)
 
 #define TURBOLEV_NON_VALUE_NODE_LIST(V) V(TransitionAndStoreArrayElement)
@@ -8112,6 +8114,54 @@ class MapPrototypeGetInt32Key
   void PrintParams(std::ostream&) const {}
 };
 
+class MapPrototypeHas : public FixedInputValueNodeT<2, MapPrototypeHas> {
+  using Base = FixedInputValueNodeT<2, MapPrototypeHas>;
+
+ public:
+  explicit MapPrototypeHas(uint64_t bitfield) : Base(bitfield) {}
+
+  // CanAllocate is needed, since finding strings in hash tables does an
+  // equality comparison which flattens strings.
+  static constexpr OpProperties kProperties =
+      OpProperties::Call() | OpProperties::CanAllocate() |
+      OpProperties::CanRead() | OpProperties::TaggedValue();
+  static constexpr typename Base::InputTypes kInputTypes{
+      ValueRepresentation::kTagged, ValueRepresentation::kTagged};
+
+  Input table_input() { return input(0); }
+  Input key_input() { return input(1); }
+
+  int MaxCallStackArgs() const {
+    // Only implemented in Turbolev.
+    UNREACHABLE();
+  }
+
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&) const {}
+};
+
+class MapPrototypeHasInt32Key
+    : public FixedInputValueNodeT<2, MapPrototypeHasInt32Key> {
+  using Base = FixedInputValueNodeT<2, MapPrototypeHasInt32Key>;
+
+ public:
+  explicit MapPrototypeHasInt32Key(uint64_t bitfield) : Base(bitfield) {}
+
+  static constexpr OpProperties kProperties = OpProperties::CanAllocate() |
+                                              OpProperties::CanRead() |
+                                              OpProperties::TaggedValue();
+  static constexpr typename Base::InputTypes kInputTypes{
+      ValueRepresentation::kTagged, ValueRepresentation::kInt32};
+
+  Input table_input() { return input(0); }
+  Input key_input() { return input(1); }
+
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&) const {}
+};
+
 class SetPrototypeHas : public FixedInputValueNodeT<2, SetPrototypeHas> {
   using Base = FixedInputValueNodeT<2, SetPrototypeHas>;
 
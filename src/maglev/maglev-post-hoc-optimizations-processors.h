@@ -149,7 +149,8 @@ class RecomputePhiUseHintsProcessor {
 };
 
 // Optimizations involving loops which cannot be done at graph building time.
-// Currently mainly loop invariant code motion.
+// Currently mainly loop invariant code motion of loads, pure computations and
+// checks (maps and bounds checks) out of the loop header.
 class LoopOptimizationProcessor {
  public:
   explicit LoopOptimizationProcessor(MaglevCompilationInfo* info)
@@ -186,10 +187,8 @@ class LoopOptimizationProcessor {
   }
 
   bool CanHoist(Node* candidate) {
-    DCHECK_EQ(candidate->input_count(), 1);
+    DCHECK_GE(candidate->input_count(), 1);
     DCHECK(current_block->is_loop());
-    ValueNode* input = candidate->input(0).node();
-    DCHECK(!IsLoopPhi(input));
     // For hoisting an instruction we need:
     // * A unique loop entry block.
     // * Inputs live before the loop (i.e., not defined inside the loop).
@@ -201,8 +200,44 @@ class LoopOptimizationProcessor {
     if (loop_entry->successors().size() != 1) {
       return false;
     }
-    if (IsConstantNode(input->opcode())) return true;
-    return input->owner() != current_block;
+    for (Input input : candidate->inputs()) {
+      ValueNode* node = input.node();
+      DCHECK(!IsLoopPhi(node));
+      if (IsConstantNode(node->opcode())) continue;
+      if (node->owner() == current_block) return false;
+    }
+    return true;
+  }
+
+  bool HasLoopPhiInput(Node* candidate) {
+    for (Input input : candidate->inputs()) {
+      if (IsLoopPhi(input.node())) return true;
+    }
+    return false;
+  }
+
+  // Checks are hoisted to the jump into the loop and deopt to its frame.
+  // Hoisting a check out of a loop can cause it to trigger more than actually
+  // needed (i.e., if the loop is executed 0 times). This could lead to
+  // deoptimization loops as there is no feedback to learn here. Thus, we
+  // abort this optimization if the function deoptimized previously. Also, if
+  // hoisting of this check fails we need to abort (and not continue) to
+  // ensure we are not hoisting other instructions over it.
+  ProcessResult ProcessCheck(Node* check) {
+    DCHECK(check->properties().can_eager_deopt());
+    if (was_deoptimized) return ProcessResult::kSkipBlock;
+    if (HasLoopPhiInput(check)) return ProcessResult::kSkipBlock;
+    if (!loop_effects->unstable_aspects_cleared && CanHoist(check)) {
+      if (auto j = current_block->predecessor_at(0)
+                       ->control_node()
+                       ->TryCast<CheckpointedJump>()) {
+        check->SetEagerDeoptInfo(
+            zone, zone->New<DeoptFrame>(j->eager_deopt_info()->top_frame()),
+            check->eager_deopt_info()->feedback_to_update());
+        return ProcessResult::kHoist;
+      }
+    }
+    return ProcessResult::kSkipBlock;
   }
 
   ProcessResult Process(LoadTaggedFieldForContextSlotNoCells* ltf,
@@ -256,28 +291,14 @@ class LoopOptimizationProcessor {
 
   ProcessResult Process(CheckMaps* maps, const ProcessingState& state) {
     DCHECK(loop_effects);
-    // Hoisting a check out of a loop can cause it to trigger more than actually
-    // needed (i.e., if the loop is executed 0 times). This could lead to
-    // deoptimization loops as there is no feedback to learn here. Thus, we
-    // abort this optimization if the function deoptimized previously. Also, if
-    // hoisting of this check fails we need to abort (and not continue) to
-    // ensure we are not hoisting other instructions over it.
-    if (was_deoptimized) return ProcessResult::kSkipBlock;
-    ValueNode* object = maps->receiver_input().node();
-    if (IsLoopPhi(object)) {
-      return ProcessResult::kSkipBlock;
-    }
-    if (!loop_effects->unstable_aspects_cleared && CanHoist(maps)) {
-      if (auto j = current_block->predecessor_at(0)
-                       ->control_node()
-                       ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(
-            zone, zone->New<DeoptFrame>(j->eager_deopt_info()->top_frame()),
-            maps->eager_deopt_info()->feedback_to_update());
-        return ProcessResult::kHoist;
-      }
-    }
-    return ProcessResult::kSkipBlock;
+    return ProcessCheck(maps);
+  }
+
+  // Bounds checks against a loop invariant index (e.g. a constant) and length.
+  ProcessResult Process(CheckInt32Condition* check,
+                        const ProcessingState& state) {
+    DCHECK(loop_effects);
+    return ProcessCheck(check);
   }
 
   template <typename NodeT>
@@ -287,6 +308,18 @@ class LoopOptimizationProcessor {
       loop_effects = nullptr;
       return ProcessResult::kSkipBlock;
     }
+    // Pure computations on loop invariant values (e.g. untagging a hoisted
+    // length for a later bounds check) can be hoisted as well.
+    if constexpr (IsValueNode(Node::opcode_of<NodeT>) &&
+                  !std::is_same_v<NodeT, Phi>) {
+      OpProperties properties = node->properties();
+      if (properties.is_pure() && !properties.can_deopt() &&
+          !properties.can_throw() && !properties.is_any_call() &&
+          !properties.not_idempotent() && node->has_inputs() &&
+          !HasLoopPhiInput(node) && CanHoist(node)) {
+        return ProcessResult::kHoist;
+      }
+    }
     return ProcessResult::kContinue;
   }
 
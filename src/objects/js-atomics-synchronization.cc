@@ -746,10 +746,18 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
                                   DirectHandle<JSAtomicsMutex> mutex,
                                   std::atomic<StateT>* state,
                                   std::optional<base::TimeDelta> timeout) {
+  bool woken_up = false;
   for (;;) {
     // Spin for a little bit to try to acquire the lock, so as to be fast under
-    // microcontention.
-    if (BackoffTryLock(requester, mutex, state)) return true;
+    // microcontention. If other threads are already sleeping on the lock it is
+    // contended beyond that, and spinning would only burn CPU and let this
+    // thread barge ahead of the waiters, so try once and go to sleep instead.
+    StateT current_state = state->load(std::memory_order_relaxed);
+    if (woken_up || !HasWaitersField::decode(current_state)) {
+      if (BackoffTryLock(requester, mutex, state)) return true;
+    } else if (TryLockExplicit(state, current_state)) {
+      return true;
+    }
 
     // At this point the lock is considered contended, so try to go to sleep and
     // put the requester thread on the waiter queue.
@@ -783,6 +791,7 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
     // After wake up we try to acquire the lock again by spinning, as the
     // contention at the point of going to sleep should not be correlated with
     // contention at the point of waking up.
+    woken_up = true;
   }
 }
 
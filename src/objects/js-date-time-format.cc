@@ -2203,21 +2203,39 @@ class DateFormatCache {
     base::MutexGuard guard(&mutex_);
     auto it = map_.find(key);
     if (it != map_.end()) {
-      return static_cast<icu::SimpleDateFormat*>(it->second->clone());
+      it->second.last_use = ++use_counter_;
+      return static_cast<icu::SimpleDateFormat*>(it->second.format->clone());
     }
 
-    if (map_.size() > 8) {  // Cache at most 8 DateFormats.
-      map_.clear();
-    }
     std::unique_ptr<icu::SimpleDateFormat> instance(
         CreateICUDateFormat(icu_locale, skeleton, generator, hc));
     if (instance == nullptr) return nullptr;
-    map_[key] = std::move(instance);
-    return static_cast<icu::SimpleDateFormat*>(map_[key]->clone());
+    // Evict the least recently used entry instead of dropping the whole
+    // cache, so that a working set slightly above the capacity (e.g. a
+    // handful of locales times a handful of styles) keeps hitting.
+    if (map_.size() >= kMaxSize) {
+      auto lru = map_.begin();
+      for (auto entry = map_.begin(); entry != map_.end(); ++entry) {
+        if (entry->second.last_use < lru->second.last_use) lru = entry;
+      }
+      map_.erase(lru);
+    }
+    Entry& entry = map_[key];
+    entry.format = std::move(instance);
+    entry.last_use = ++use_counter_;
+    return static_cast<icu::SimpleDateFormat*>(entry.format->clone());
   }
 
  private:
-  std::map<std::string, std::unique_ptr<icu::SimpleDateFormat>> map_;
+  static constexpr size_t kMaxSize = 32;
+
+  struct Entry {
+    std::unique_ptr<icu::SimpleDateFormat> format;
+    uint64_t last_use = 0;
+  };
+
+  std::map<std::string, Entry> map_;
+  uint64_t use_counter_ = 0;
   base::Mutex mutex_;
 };
 
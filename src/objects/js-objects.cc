@@ -2294,20 +2294,39 @@ MaybeDirectHandle<FixedArray> GetOwnValuesOrEntries(
   values_or_entries = isolate->factory()->NewFixedArray(keys->length());
   int length = 0;
 
+  // Ordinary objects (e.g. in dictionary mode) can't observe whether the
+  // attributes and the value of a key are looked up separately, so do both
+  // with a single lookup.
+  const bool single_lookup =
+      IsJSObject(*object) && !IsCustomElementsReceiverMap(object->map());
+
   for (int i = 0; i < keys->length(); ++i) {
     DirectHandle<Name> key(Cast<Name>(keys->get(i)), isolate);
 
-    if (filter & ONLY_ENUMERABLE) {
-      PropertyDescriptor descriptor;
-      Maybe<bool> did_get_descriptor = JSReceiver::GetOwnPropertyDescriptor(
-          isolate, object, key, &descriptor);
-      MAYBE_RETURN(did_get_descriptor, MaybeDirectHandle<FixedArray>());
-      if (!did_get_descriptor.FromJust() || !descriptor.enumerable()) continue;
-    }
-
     DirectHandle<Object> value;
-    ASSIGN_RETURN_ON_EXCEPTION(
-        isolate, value, Object::GetPropertyOrElement(isolate, object, key));
+    if (single_lookup) {
+      PropertyKey lookup_key(isolate, key);
+      LookupIterator it(isolate, object, lookup_key, LookupIterator::OWN);
+      if (!it.IsFound()) continue;
+      // An index past the end of a typed array counts as found but has no
+      // property details. Like GetOwnPropertyDescriptor, treat it as absent.
+      if (it.state() == LookupIterator::TYPED_ARRAY_INDEX_NOT_FOUND) continue;
+      if ((filter & ONLY_ENUMERABLE) && !it.IsEnumerable()) continue;
+      ASSIGN_RETURN_ON_EXCEPTION(isolate, value, Object::GetProperty(&it));
+    } else {
+      if (filter & ONLY_ENUMERABLE) {
+        PropertyDescriptor descriptor;
+        Maybe<bool> did_get_descriptor = JSReceiver::GetOwnPropertyDescriptor(
+            isolate, object, key, &descriptor);
+        MAYBE_RETURN(did_get_descriptor, MaybeDirectHandle<FixedArray>());
+        if (!did_get_descriptor.FromJust() || !descriptor.enumerable()) {
+          continue;
+        }
+      }
+
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, value, Object::GetPropertyOrElement(isolate, object, key));
+    }
 
     if (get_entries) {
       DirectHandle<FixedArray> entry_storage =
@@ -136,6 +136,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // The heuristic value for the length of the subject string for which we
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
+  // Large patterns are expensive to compile to native code, so the subject
+  // length threshold above grows with the pattern length by this factor.
+  static constexpr int kTierUpForSubjectLengthPerPatternCharacter = 16;
 
   // Maximum number of captures allowed.
   static constexpr int kMaxCaptures = 1 << 16;
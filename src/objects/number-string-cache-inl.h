@@ -81,8 +81,23 @@ void SmiStringCache::Set(Isolate* isolate, InternalIndex entry,
         base::bits::RoundUpToPowerOfTwo32(v8_flags.smi_string_cache_size);
     CHECK_LT(kInitialSize, full_size);
     CHECK_LE(full_size, kMaxCapacity);
-    // TODO(ishell): consider copying entries from previous table.
+    DirectHandle<SmiStringCache> initial_cache = cache;
     cache = SmiStringCache::New(isolate, full_size);
+    {
+      // Keep the entries collected so far. The full-size table uses a wider
+      // mask of the same hash, so they can't collide with each other.
+      DisallowGarbageCollection no_gc;
+      for (auto i : InternalIndex::Range(initial_cache->capacity())) {
+        uint32_t from = i.as_uint32() * kEntrySize;
+        Tagged<Object> key = initial_cache->get(from + kEntryKeyIndex);
+        if (key == kEmptySentinel) continue;
+        uint32_t to =
+            cache->GetEntryFor(Cast<Smi>(key)).as_uint32() * kEntrySize;
+        cache->set(to + kEntryKeyIndex, key);
+        cache->set(to + kEntryValueIndex,
+                   initial_cache->get(from + kEntryValueIndex));
+      }
+    }
     isolate->heap()->SetSmiStringCache(*cache);
 
     entry = cache->GetEntryFor(number);
@@ -174,7 +189,21 @@ void DoubleStringCache::Set(Isolate* isolate, InternalIndex entry_index,
         base::bits::RoundUpToPowerOfTwo32(v8_flags.double_string_cache_size);
     CHECK_LT(kInitialSize, full_size);
     CHECK_LE(full_size, kMaxCapacity);
+    DirectHandle<DoubleStringCache> initial_cache = cache;
     cache = DoubleStringCache::New(isolate, full_size);
+    {
+      // Keep the entries collected so far. The full-size table uses a wider
+      // mask of the same hash, so they can't collide with each other.
+      DisallowGarbageCollection no_gc;
+      for (const Entry& from : **initial_cache) {
+        Tagged<UnionOf<Smi, String>> value = from.value_.load();
+        if (value == kEmptySentinel) continue;
+        uint64_t bits = from.key_.value_as_bits();
+        Entry* to = &cache->entries()[cache->GetEntryFor(bits).as_uint32()];
+        to->key_.set_value_as_bits(bits);
+        to->value_.store(&**cache, value);
+      }
+    }
     isolate->heap()->SetDoubleStringCache(*cache);
 
     entry_index = cache->GetEntryFor(number_bits);
@@ -799,6 +799,13 @@ inline void Print(Tagged<Object> obj, std::ostream& os) { ShortPrint(obj, os); }
 //    31 bits),
 // b) it's independent of the pointer compression base and pointer compression
 //    scheme.
+//
+// With pointer compression the map word is a 32-bit compressed map pointer,
+// i.e. it is already as large as an index into a dedicated map table would
+// be. Packing further header bits (e.g. hash or age) into it would require
+// every map word reader, including the GC's forwarding and marking paths and
+// generated code, to mask the value; the identity hash therefore lives in the
+// properties-or-hash field instead.
 class MapWord {
  public:
   // Normal state: the map word contains a map pointer.
@@ -292,6 +292,9 @@ HandleType<Derived>::MaybeType OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
+  // Every entry is still re-hashed and copied; only the write barriers for
+  // the copied keys and values are skipped if the new table allows it.
+  WriteBarrierModeScope mode = new_table->GetWriteBarrierMode(no_gc);
 
   for (InternalIndex old_entry : table->IterateEntries()) {
     int old_entry_raw = old_entry.as_int();
@@ -309,7 +312,7 @@ HandleType<Derived>::MaybeType OrderedHashTable<Derived, entrysize>::Rehash(
     int old_index = table->EntryToIndexRaw(old_entry_raw);
     for (int i = 0; i < entrysize; ++i) {
       Tagged<Object> value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      new_table->set(new_index + i, value, *mode);
     }
     new_table->set(new_index + kChainOffset, chain_entry);
     ++new_entry;
@@ -165,7 +165,17 @@ StringTable::StringTable(Isolate* isolate)
   DCHECK_EQ(deleted_element(), OffHeapStringHashSet::deleted_element());
 }
 
-StringTable::~StringTable() { delete data_; }
+StringTable::~StringTable() {
+  if (V8_UNLIKELY(v8_flags.trace_string_table_stats)) {
+    WriteStats stats = GetWriteStats();
+    PrintF("StringTable: elements=%d capacity=%d insertions=%zu "
+           "contended_insertions=%zu resizes=%zu\n",
+           data_.load(std::memory_order_relaxed)->table().number_of_elements(),
+           Capacity(), stats.insertions, stats.contended_insertions,
+           stats.resizes);
+  }
+  delete data_;
+}
 
 int StringTable::Capacity() const {
   return data_.load(std::memory_order_acquire)->table().capacity();
@@ -388,6 +398,29 @@ DirectHandle<String> StringTable::LookupString(Isolate* isolate,
   return result;
 }
 
+namespace {
+
+// Like base::MutexGuard, but counts acquisitions that had to wait for another
+// thread to release the mutex.
+class V8_NODISCARD CountingMutexGuard final {
+ public:
+  CountingMutexGuard(base::Mutex* mutex, std::atomic<size_t>* contended)
+      : mutex_(mutex) {
+    if (!mutex_->TryLock()) {
+      contended->fetch_add(1, std::memory_order_relaxed);
+      mutex_->Lock();
+    }
+  }
+  CountingMutexGuard(const CountingMutexGuard&) = delete;
+  CountingMutexGuard& operator=(const CountingMutexGuard&) = delete;
+  ~CountingMutexGuard() { mutex_->Unlock(); }
+
+ private:
+  base::Mutex* const mutex_;
+};
+
+}  // namespace
+
 template <typename StringTableKey, typename IsolateT>
 DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
                                             StringTableKey* key) {
@@ -447,7 +480,8 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    CountingMutexGuard table_write_guard(&write_mutex_,
+                                         &contended_insertions_);
 
     Data* data = EnsureCapacity(isolate, 1);
     OffHeapStringHashSet& table = data->table();
@@ -463,6 +497,7 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
       DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
       DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
       table.AddAt(isolate, entry, *new_string);
+      insertions_.fetch_add(1, std::memory_order_relaxed);
       return new_string;
     } else if (element == OffHeapStringHashSet::deleted_element()) {
       // This entry was deleted, so overwrite it and register that we
@@ -470,6 +505,7 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
       DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
       DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
       table.OverwriteDeletedAt(isolate, entry, *new_string);
+      insertions_.fetch_add(1, std::memory_order_relaxed);
       return new_string;
     } else {
       // Return the existing string as a handle.
@@ -517,6 +553,7 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
     // the pointer.
     data = new_data.release();
     data_.store(data, std::memory_order_release);
+    resizes_.fetch_add(1, std::memory_order_relaxed);
   }
 
   return data;
@@ -725,6 +762,15 @@ size_t StringTable::GetCurrentMemoryUsage() const {
          data_.load(std::memory_order_acquire)->GetCurrentMemoryUsage();
 }
 
+StringTable::WriteStats StringTable::GetWriteStats() const {
+  WriteStats stats;
+  stats.insertions = insertions_.load(std::memory_order_relaxed);
+  stats.contended_insertions =
+      contended_insertions_.load(std::memory_order_relaxed);
+  stats.resizes = resizes_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void StringTable::IterateElements(RootVisitor* visitor) {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
@@ -82,6 +82,18 @@ class V8_EXPORT_PRIVATE StringTable {
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
+  // Counters for the write path, which is serialized by the write lock. These
+  // are updated with relaxed atomics and may be read at any time.
+  struct WriteStats {
+    // Strings added to the table by LookupKey.
+    size_t insertions = 0;
+    // Insertion attempts that had to wait for the write lock.
+    size_t contended_insertions = 0;
+    // Reallocations of the table when growing or shrinking.
+    size_t resizes = 0;
+  };
+  WriteStats GetWriteStats() const;
+
   // The following methods must be called either while holding the write lock,
   // or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
@@ -101,6 +113,10 @@ class V8_EXPORT_PRIVATE StringTable {
   // NumberOfElements) are allowed to lock it while staying const.
   mutable base::Mutex write_mutex_;
   Isolate* isolate_;
+
+  std::atomic<size_t> insertions_{0};
+  std::atomic<size_t> contended_insertions_{0};
+  std::atomic<size_t> resizes_{0};
 };
 
 }  // namespace internal
@@ -325,6 +325,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetShareLargeStrings(bool mode) {
+  share_large_strings_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -509,7 +513,13 @@ Maybe<bool> ValueSerializer::WriteObject(DirectHandle<Object> object) {
     }
     default:
       if (InstanceTypeChecker::IsString(instance_type)) {
-        WriteString(Cast<String>(object));
+        DirectHandle<String> string = Cast<String>(object);
+        if (ShouldShareString(*string)) {
+          // The string is moved into the shared heap once (in place if
+          // possible), after which the receiver uses it without a copy.
+          return WriteSharedObject(String::Share(isolate_, string));
+        }
+        WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (InstanceTypeChecker::IsJSReceiver(instance_type)) {
         return WriteJSReceiver(Cast<JSReceiver>(object));
@@ -519,6 +529,14 @@ Maybe<bool> ValueSerializer::WriteObject(DirectHandle<Object> object) {
   }
 }
 
+bool ValueSerializer::ShouldShareString(Tagged<String> string) const {
+  // Small strings are cheaper to copy than to pass through the conveyor.
+  static constexpr uint32_t kMinSharedStringLength = 1024;
+  return share_large_strings_ && v8_flags.shared_string_table &&
+         isolate_->has_shared_space() && delegate_ != nullptr &&
+         string->length() >= kMinSharedStringLength;
+}
+
 void ValueSerializer::WriteOddball(Tagged<Oddball> oddball) {
   SerializationTag tag = SerializationTag::kUndefined;
   switch (oddball->kind()) {
@@ -97,6 +97,12 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to share large strings through the shared object
+   * conveyor instead of copying them. See v8::ValueSerializer.
+   */
+  void SetShareLargeStrings(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -117,6 +123,7 @@ class ValueSerializer {
   void WriteSmi(Tagged<Smi> smi);
   void WriteHeapNumber(Tagged<HeapNumber> number);
   void WriteBigInt(Tagged<BigInt> bigint);
+  bool ShouldShareString(Tagged<String> string) const;
   void WriteString(DirectHandle<String> string);
   Maybe<bool> WriteJSReceiver(DirectHandle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
@@ -180,6 +187,7 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool share_large_strings_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <optional>
 
+#include "hwy/highway.h"
 #include "src/ast/ast-value-factory.h"
 #include "src/base/strings.h"
 #include "src/base/vlq-base64.h"
@@ -231,13 +232,55 @@ Token::Value Scanner::SkipSingleHTMLComment() {
   return SkipSingleLineComment();
 }
 
+namespace {
+
+// Skips 8-code-unit blocks that contain neither a line terminator (if
+// |kStopAtLineTerminator|) nor a '*' (if |kStopAtAsterisk|). Returns the
+// position of the first block containing such a code unit, or the start of
+// the trailing partial block, which the caller needs to scan itself.
+template <bool kStopAtLineTerminator, bool kStopAtAsterisk>
+const uint16_t* SkipCommentCharactersSIMD(const uint16_t* cursor,
+                                          const uint16_t* end) {
+  static_assert(kStopAtLineTerminator || kStopAtAsterisk);
+  namespace hw = hwy::HWY_NAMESPACE;
+
+  hw::FixedTag<uint16_t, 8> tag;
+  static constexpr size_t stride = hw::Lanes(tag);
+
+  const auto mask_asterisk = hw::Set(tag, '*');
+  const auto mask_new_line = hw::Set(tag, '\n');
+  const auto mask_carriage_return = hw::Set(tag, '\r');
+  // U+2028 and U+2029 only differ in the lowest bit.
+  const auto mask_one = hw::Set(tag, 1);
+  const auto mask_paragraph_separator = hw::Set(tag, 0x2029);
+
+  for (; cursor + (stride - 1) < end; cursor += stride) {
+    const auto input = hw::LoadU(tag, cursor);
+    const auto is_asterisk = input == mask_asterisk;
+    const auto is_line_terminator =
+        hw::Or(hw::Or(input == mask_new_line, input == mask_carriage_return),
+               hw::Or(input, mask_one) == mask_paragraph_separator);
+    const auto result = !kStopAtLineTerminator ? is_asterisk
+                        : !kStopAtAsterisk
+                            ? is_line_terminator
+                            : hw::Or(is_asterisk, is_line_terminator);
+    if (!hw::AllFalse(tag, result)) {
+      return cursor + hw::FindKnownFirstTrue(tag, result);
+    }
+  }
+  return cursor;
+}
+
+}  // namespace
+
 Token::Value Scanner::SkipSingleLineComment() {
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil(SkipCommentCharactersSIMD<true, false>,
+               [](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::kWhitespace;
 }
@@ -376,7 +419,7 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
+      AdvanceUntil(SkipCommentCharactersSIMD<true, true>, [](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
         }
@@ -401,7 +444,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil(SkipCommentCharactersSIMD<false, true>,
+                 [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -75,7 +75,19 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
+    return AdvanceUntil(
+        [](const uint16_t* cursor, const uint16_t* end) { return cursor; },
+        check);
+  }
+
+  // Same as above, but first lets |skip| advance over a prefix of the
+  // buffered code units that is known not to meet the check's requirement,
+  // e.g. whole SIMD blocks. |skip| returns a position between its arguments.
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntil(SkipFunctionType skip,
+                                    FunctionType check) {
     while (true) {
+      buffer_cursor_ = skip(buffer_cursor_, buffer_end_);
       auto next_cursor_pos =
           std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
@@ -563,6 +575,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(SkipFunctionType skip, FunctionType check) {
+    c0_ = source_->AdvanceUntil(skip, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -963,7 +963,9 @@ void CodeEntryStorage::DecRef(CodeEntry* entry) {
 }
 
 InstructionStreamMap::InstructionStreamMap(CodeEntryStorage& storage)
-    : code_entries_(storage) {}
+    : code_entries_(storage) {
+  FlushLookupCache();
+}
 
 InstructionStreamMap::~InstructionStreamMap() { Clear(); }
 
@@ -978,20 +980,44 @@ void InstructionStreamMap::Clear() {
   }
 
   code_map_.clear();
+  FlushLookupCache();
+}
+
+void InstructionStreamMap::FlushLookupCache() {
+  for (LookupCacheEntry& cached : lookup_cache_) {
+    cached = {kNullAddress, kNullAddress, nullptr};
+  }
+}
+
+void InstructionStreamMap::InvalidateLookupCache(Address start, Address end) {
+  // A cached lookup of |addr| resolved to the entry starting at
+  // |instruction_start|. Adding or removing an entry that starts in
+  // [start, end) can only change that result if the entry starts in
+  // [instruction_start, addr].
+  for (LookupCacheEntry& cached : lookup_cache_) {
+    if (cached.entry != nullptr && cached.addr >= start &&
+        cached.instruction_start < end) {
+      cached = {kNullAddress, kNullAddress, nullptr};
+    }
+  }
 }
 
 void InstructionStreamMap::AddCode(Address addr, CodeEntry* entry,
                                    unsigned size) {
   code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
   entry->set_instruction_start(addr);
+  InvalidateLookupCache(addr, addr + std::max(size, 1u));
 }
 
 bool InstructionStreamMap::RemoveCode(CodeEntry* entry) {
   auto range = code_map_.equal_range(entry->instruction_start());
   for (auto i = range.first; i != range.second; ++i) {
     if (i->second.entry == entry) {
+      Address start = i->first;
+      Address end = start + std::max(i->second.size, 1u);
       code_entries_.DecRef(entry);
       code_map_.erase(i);
+      InvalidateLookupCache(start, end);
       return true;
     }
   }
@@ -1004,11 +1030,14 @@ void InstructionStreamMap::ClearCodesInRange(Address start, Address end) {
     --left;
     if (left->first + left->second.size <= start) ++left;
   }
+  Address invalidate_start =
+      left != code_map_.end() ? std::min(left->first, start) : start;
   auto right = left;
   for (; right != code_map_.end() && right->first < end; ++right) {
     code_entries_.DecRef(right->second.entry);
   }
   code_map_.erase(left, right);
+  InvalidateLookupCache(invalidate_start, end);
 }
 
 CodeEntry* InstructionStreamMap::FindEntry(Address addr,
@@ -1016,6 +1045,13 @@ CodeEntry* InstructionStreamMap::FindEntry(Address addr,
   // Note that an address may correspond to multiple CodeEntry objects. An
   // arbitrary selection is made (as per multimap spec) in the event of a
   // collision.
+  LookupCacheEntry& cached = lookup_cache_[LookupCacheIndex(addr)];
+  if (cached.entry != nullptr && cached.addr == addr) {
+    if (out_instruction_start) {
+      *out_instruction_start = cached.instruction_start;
+    }
+    return cached.entry;
+  }
   auto it = code_map_.upper_bound(addr);
   if (it == code_map_.begin()) return nullptr;
   --it;
@@ -1023,6 +1059,7 @@ CodeEntry* InstructionStreamMap::FindEntry(Address addr,
   Address end_address = start_address + it->second.size;
   CodeEntry* ret = addr < end_address ? it->second.entry : nullptr;
   DCHECK(!ret || (addr >= start_address && addr < end_address));
+  if (ret) cached = {addr, start_address, ret};
   if (ret && out_instruction_start) *out_instruction_start = start_address;
   return ret;
 }
@@ -1036,8 +1073,10 @@ void InstructionStreamMap::MoveCode(Address from, Address to) {
   // end of the equal elements range after insertions.
   size_t distance = std::distance(range.first, range.second);
   auto it = range.first;
+  unsigned max_size = 1;
   while (distance--) {
     CodeEntryMapInfo& info = it->second;
+    max_size = std::max(max_size, info.size);
     DCHECK(info.entry);
     DCHECK_EQ(info.entry->instruction_start(), from);
     info.entry->set_instruction_start(to);
@@ -1048,6 +1087,8 @@ void InstructionStreamMap::MoveCode(Address from, Address to) {
   }
 
   code_map_.erase(range.first, it);
+  InvalidateLookupCache(from, from + max_size);
+  InvalidateLookupCache(to, to + max_size);
 }
 
 void InstructionStreamMap::Print() {
@@ -526,8 +526,28 @@ class V8_EXPORT_PRIVATE InstructionStreamMap {
     unsigned size;
   };
 
+  // Direct-mapped cache of FindEntry results keyed by the exact address.
+  // Samples keep hitting the same pcs and return addresses, which avoids
+  // walking the multimap for most frames. Mutations only invalidate the
+  // cached results they can affect; Clear() flushes the whole cache.
+  struct LookupCacheEntry {
+    Address addr;
+    Address instruction_start;
+    CodeEntry* entry;
+  };
+  static constexpr size_t kLookupCacheSize = 256;
+  static size_t LookupCacheIndex(Address addr) {
+    return static_cast<size_t>((addr >> 2) ^ (addr >> 10)) &
+           (kLookupCacheSize - 1);
+  }
+  void FlushLookupCache();
+  // Drops cached results that may depend on entries starting in
+  // [start, end).
+  void InvalidateLookupCache(Address start, Address end);
+
   std::multimap<Address, CodeEntryMapInfo> code_map_;
   CodeEntryStorage& code_entries_;
+  LookupCacheEntry lookup_cache_[kLookupCacheSize];
 };
 
 // Manages the lifetime of CodeEntry objects, and stores shared resources
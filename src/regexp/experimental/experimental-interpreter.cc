@@ -237,6 +237,239 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+// A lazily constructed DFA that decides whether the input contains a match of
+// a regexp, without determining its position or captures.  Each DFA state is
+// the set of PCs of character-consuming instructions that NFA threads can be
+// blocked at, and its transitions are computed on first use and cached per
+// character class.  The classes partition the UC16 range at the bounds of the
+// regexp's character ranges, so all characters of a class, one-byte or
+// two-byte, lead to the same successor.  Thread priorities and the
+// empty-iteration check of quantifiers are ignored, so the DFA accepts a
+// superset of the inputs the NFA matches: if it rejects the input, the NFA
+// would not find a match either.  The number of states is bounded; when the
+// limit is reached, `MayMatch` conservatively returns true and the caller
+// falls back to the NFA.
+//
+// Regexps with assertions or lookarounds are not supported.
+template <class Character>
+class LazyDfa {
+ public:
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, Zone* zone)
+      : bytecode_(bytecode),
+        states_(0, zone),
+        worklist_(zone),
+        closure_pcs_(zone),
+        closure_marks_(bytecode.length(), 0, zone),
+        closure_generation_(0),
+        class_bounds_(zone),
+        is_supported_(IsSupported(bytecode)),
+        zone_(zone) {
+    if (is_supported_) ComputeCharacterClasses();
+  }
+
+  // Returns false if no match of the regexp starts at or after `start_index`
+  // in `input`.
+  bool MayMatch(base::Vector<const Character> input, int start_index) {
+    if (!is_supported_) return true;
+    if (states_.is_empty()) {
+      worklist_.push_back(0);
+      InternState();
+    }
+
+    int state = 0;
+    for (int i = start_index;; ++i) {
+      if (states_[state]->accepting) return true;
+      if (states_[state]->pcs.empty()) return false;
+      if (i == input.length()) return false;
+
+      Character c = input[i];
+      int character_class = CharacterClass(c);
+      int next = states_[state]->transitions[character_class];
+      if (next == kUnknownState) {
+        next = ComputeTransition(state, c, character_class);
+        if (next == kCacheFull) return true;
+      }
+      state = next;
+    }
+  }
+
+ private:
+  static constexpr int kMaxStates = 127;
+  static constexpr int kOneByteTableSize = 256;
+  static constexpr int8_t kUnknownState = -1;
+  static constexpr int kCacheFull = -2;
+
+  struct State {
+    State(int class_count, Zone* zone)
+        : pcs(zone), transitions(class_count, kUnknownState, zone) {}
+
+    // Sorted PCs of CONSUME_RANGE and RANGE_COUNT instructions.
+    ZoneVector<int> pcs;
+    // Whether an ACCEPT instruction can be reached without consuming input.
+    bool accepting = false;
+    // Successor states indexed by character class.
+    ZoneVector<int8_t> transitions;
+  };
+
+  static bool IsSupported(base::Vector<const RegExpInstruction> bytecode) {
+    for (const RegExpInstruction& inst : bytecode) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::START_LOOKAROUND:
+        case RegExpInstruction::END_LOOKAROUND:
+        case RegExpInstruction::WRITE_LOOKAROUND_TABLE:
+        case RegExpInstruction::READ_LOOKAROUND_TABLE:
+          return false;
+        default:
+          break;
+      }
+    }
+    return true;
+  }
+
+  // Splits the UC16 range into classes of characters that are contained in
+  // exactly the same CONSUME_RANGE instructions.  Class `i` starts at
+  // `class_bounds_[i]` and ends before `class_bounds_[i + 1]`.
+  void ComputeCharacterClasses() {
+    class_bounds_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      class_bounds_.push_back(inst.payload.consume_range.min);
+      if (inst.payload.consume_range.max < kMaxUInt16) {
+        class_bounds_.push_back(inst.payload.consume_range.max + 1);
+      }
+    }
+    std::sort(class_bounds_.begin(), class_bounds_.end());
+    class_bounds_.erase(
+        std::unique(class_bounds_.begin(), class_bounds_.end()),
+        class_bounds_.end());
+    for (int c = 0; c < kOneByteTableSize; ++c) {
+      one_byte_classes_[c] = static_cast<int>(
+          std::upper_bound(class_bounds_.begin(), class_bounds_.end(), c) -
+          class_bounds_.begin() - 1);
+    }
+  }
+
+  int CharacterClass(Character c) const {
+    if (c < kOneByteTableSize) return one_byte_classes_[c];
+    return static_cast<int>(
+        std::upper_bound(class_bounds_.begin(), class_bounds_.end(),
+                         static_cast<int>(c)) -
+        class_bounds_.begin() - 1);
+  }
+
+  // Computes the successor of `state` on `c` and caches it for all characters
+  // of `c`'s class.  Returns kCacheFull if the successor would exceed the
+  // state limit.
+  int ComputeTransition(int state, Character c, int character_class) {
+    worklist_.clear();
+    for (int pc : states_[state]->pcs) {
+      int first_range_pc = pc;
+      int range_count = 1;
+      if (bytecode_[pc].opcode == RegExpInstruction::RANGE_COUNT) {
+        range_count = bytecode_[pc].payload.num_ranges;
+        ++first_range_pc;
+      }
+      const int next_pc = first_range_pc + range_count;
+      for (int range_pc = first_range_pc; range_pc < next_pc; ++range_pc) {
+        RegExpInstruction::Uc16Range range =
+            bytecode_[range_pc].payload.consume_range;
+        if (c >= range.min && c <= range.max) {
+          worklist_.push_back(next_pc);
+          break;
+        }
+      }
+    }
+
+    int next = InternState();
+    if (next != kCacheFull) {
+      states_[state]->transitions[character_class] = static_cast<int8_t>(next);
+    }
+    return next;
+  }
+
+  // Returns the index of the state reached from the PCs in `worklist_`
+  // without consuming input, adding it to `states_` if it is new.
+  int InternState() {
+    bool accepting = false;
+    ComputeClosure(&accepting);
+
+    for (int i = 0; i < states_.length(); ++i) {
+      if (states_[i]->accepting == accepting &&
+          states_[i]->pcs == closure_pcs_) {
+        return i;
+      }
+    }
+    if (states_.length() == kMaxStates) return kCacheFull;
+    State* state =
+        zone_->New<State>(static_cast<int>(class_bounds_.size()), zone_);
+    state->pcs = closure_pcs_;
+    state->accepting = accepting;
+    states_.Add(state, zone_);
+    return states_.length() - 1;
+  }
+
+  // Follows all transitions that don't consume input from the PCs in
+  // `worklist_` and stores the reached character-consuming PCs in
+  // `closure_pcs_`.
+  void ComputeClosure(bool* accepting) {
+    ++closure_generation_;
+    closure_pcs_.clear();
+    while (!worklist_.empty()) {
+      int pc = worklist_.back();
+      worklist_.pop_back();
+      SBXCHECK_GE(pc, 0);
+      SBXCHECK_LT(pc, bytecode_.size());
+      if (closure_marks_[pc] == closure_generation_) continue;
+      closure_marks_[pc] = closure_generation_;
+
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+        case RegExpInstruction::RANGE_COUNT:
+          closure_pcs_.push_back(pc);
+          break;
+        case RegExpInstruction::ACCEPT:
+          *accepting = true;
+          break;
+        case RegExpInstruction::FORK:
+          worklist_.push_back(inst.payload.pc);
+          worklist_.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist_.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+          worklist_.push_back(pc + 1);
+          break;
+        default:
+          // Rejected by `IsSupported`, and FILTER_* instructions are only
+          // reachable after ACCEPT.
+          UNREACHABLE();
+      }
+    }
+    std::sort(closure_pcs_.begin(), closure_pcs_.end());
+  }
+
+  base::Vector<const RegExpInstruction> bytecode_;
+  ZoneList<State*> states_;
+  // Scratch space for computing new states.
+  ZoneVector<int> worklist_;
+  ZoneVector<int> closure_pcs_;
+  // Marks PCs visited by the current `ComputeClosure` invocation.
+  ZoneVector<uint32_t> closure_marks_;
+  uint32_t closure_generation_;
+  // Sorted first characters of the character classes, starting with 0.
+  ZoneVector<int> class_bounds_;
+  int one_byte_classes_[kOneByteTableSize];
+  bool is_supported_;
+  Zone* zone_;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -365,6 +598,8 @@ class NfaInterpreter {
         reverse_(false),
         current_lookaround_(-1),
         filter_groups_pc_(std::nullopt),
+        first_character_ranges_(std::nullopt),
+        lazy_dfa_(std::nullopt),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -464,6 +699,13 @@ class NfaInterpreter {
           sizeof(InterpreterThread);
     }
 
+    if (lookarounds_.is_empty()) {
+      ComputeFirstCharacterRanges();
+      if (v8_flags.experimental_regexp_engine_lazy_dfa) {
+        lazy_dfa_.emplace(bytecode_, zone_);
+      }
+    }
+
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
   }
@@ -485,6 +727,10 @@ class NfaInterpreter {
 
     int match_num = 0;
     while (match_num != max_match_num) {
+      if (lazy_dfa_.has_value() && !lazy_dfa_->MayMatch(input_, input_index_)) {
+        break;
+      }
+
       int err_code = FindNextMatch();
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
 
@@ -700,6 +946,14 @@ class NfaInterpreter {
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
 
+      // If only the thread of the /.*?/ preamble is left, no match can start
+      // before the next character accepted by the body of the regexp.
+      if (first_character_ranges_.has_value() && !FoundMatch() &&
+          blocked_threads_.length() == 1 &&
+          blocked_threads_[0].pc == kPreambleConsumePc) {
+        SkipToNextMatchCandidate();
+      }
+
       if (lookbehind_table_.has_value()) {
         std::fill(lookbehind_table_->begin(), lookbehind_table_->end(), false);
       }
@@ -1152,6 +1406,111 @@ class NfaInterpreter {
 
   bool FoundMatch() const { return best_match_thread_.has_value(); }
 
+  // The compiler emits the following preamble for unanchored regexps (see
+  // `CompileNonGreedyStar`):
+  //
+  //     0: FORK 2
+  //     1: JMP body
+  //     2: BEGIN_LOOP
+  //     3: CONSUME_RANGE [0x0000-0xFFFF]
+  //     4: END_LOOP
+  //     5: FORK 2
+  //   body:
+  //     ...
+  static constexpr int kPreambleConsumePc = 3;
+  static constexpr int kPreambleLength = 6;
+  static constexpr int kMaxFirstCharacterRanges = 8;
+
+  // If the regexp has the above preamble and every match of its body starts
+  // by consuming a character, collects the ranges of these characters into
+  // `first_character_ranges_`. Input positions at which none of them occurs
+  // can then be skipped without running the automaton.
+  void ComputeFirstCharacterRanges() {
+    if (bytecode_.length() <= kPreambleLength) return;
+    if (bytecode_[0].opcode != RegExpInstruction::FORK ||
+        bytecode_[0].payload.pc != 2 ||
+        bytecode_[1].opcode != RegExpInstruction::JMP ||
+        bytecode_[1].payload.pc != kPreambleLength ||
+        bytecode_[2].opcode != RegExpInstruction::BEGIN_LOOP ||
+        bytecode_[kPreambleConsumePc].opcode !=
+            RegExpInstruction::CONSUME_RANGE ||
+        bytecode_[kPreambleConsumePc].payload.consume_range.min != 0x0000 ||
+        bytecode_[kPreambleConsumePc].payload.consume_range.max != 0xFFFF ||
+        bytecode_[4].opcode != RegExpInstruction::END_LOOP ||
+        bytecode_[5].opcode != RegExpInstruction::FORK ||
+        bytecode_[5].payload.pc != 2) {
+      return;
+    }
+
+    ZoneList<RegExpInstruction::Uc16Range> ranges(0, zone_);
+    ZoneVector<bool> visited(bytecode_.length(), false, zone_);
+    ZoneList<int> worklist(0, zone_);
+    worklist.Add(kPreambleLength, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (visited[pc]) continue;
+      visited[pc] = true;
+
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+        case RegExpInstruction::RANGE_COUNT: {
+          int num_ranges = 1;
+          if (inst.opcode == RegExpInstruction::RANGE_COUNT) {
+            num_ranges = inst.payload.num_ranges;
+            ++pc;
+          }
+          if (ranges.length() + num_ranges > kMaxFirstCharacterRanges) return;
+          for (int i = pc; i < pc + num_ranges; ++i) {
+            DCHECK_EQ(bytecode_[i].opcode, RegExpInstruction::CONSUME_RANGE);
+            ranges.Add(bytecode_[i].payload.consume_range, zone_);
+          }
+          break;
+        }
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+          worklist.Add(pc + 1, zone_);
+          break;
+        default:
+          // The body may match the empty string, depends on an assertion, or
+          // uses an instruction we don't know how to handle here.
+          return;
+      }
+    }
+    first_character_ranges_.emplace(ranges.length(), zone_);
+    first_character_ranges_->AddAll(ranges, zone_);
+  }
+
+  bool IsFirstCharacter(Character c) const {
+    for (const RegExpInstruction::Uc16Range& range : *first_character_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Called while the preamble thread is the only blocked thread. Advances
+  // `input_index_` such that the preamble consumes every character up to the
+  // next position at which the body of the regexp could start matching.
+  void SkipToNextMatchCandidate() {
+    DCHECK(!reverse_);
+    DCHECK_LT(input_index_, input_.length());
+    int candidate = input_index_ + 1;
+    while (candidate < input_.length() && !IsFirstCharacter(input_[candidate])) {
+      ++candidate;
+    }
+    input_index_ = candidate - 1;
+  }
+
   size_t ApproximateTotalMemoryUsage() {
     return (blocked_threads_.length() + active_threads_.length()) *
            memory_consumption_per_thread_;
@@ -1540,6 +1899,15 @@ class NfaInterpreter {
   // quantifiers).
   std::optional<int> filter_groups_pc_;
 
+  // Ranges of the characters that a match of the regexp body can start with.
+  // Only computed for unanchored regexps without lookarounds whose body
+  // cannot match the empty string. See `ComputeFirstCharacterRanges`.
+  std::optional<ZoneList<RegExpInstruction::Uc16Range>> first_character_ranges_;
+
+  // Used to reject inputs without a match before running the NFA. Only
+  // constructed for regexps without lookarounds, see `FindMatches`.
+  std::optional<LazyDfa<Character>> lazy_dfa_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
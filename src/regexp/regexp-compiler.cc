@@ -3043,8 +3043,10 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
     return;
   }
 
-  if (found_single_character) {
-    // TODO(pthier): Add vectorized version.
+  // The vectorized table scan below handles a single character as well and
+  // outperforms the scalar loop when it is available.
+  if (found_single_character &&
+      !masm->SkipUntilBitInTableUseSimd(lookahead_width)) {
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
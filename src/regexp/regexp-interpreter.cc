@@ -403,7 +403,7 @@ IrregexpInterpreter::Result RawMatch(
     Tagged<String>* subject_string, base::Vector<const Char> subject,
     int* output_registers, int output_register_count, int total_register_count,
     int current, uint32_t current_char, RegExp::CallOrigin call_origin,
-    const uint32_t backtrack_limit) {
+    const uint32_t backtrack_limit, uint32_t* backtrack_count_out) {
   DisallowGarbageCollection no_gc;
 
 #if V8_USE_COMPUTED_GOTO
@@ -569,11 +569,17 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(FAIL) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       return IrregexpInterpreter::FAILURE;
     }
     BYTECODE(SUCCEED) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       registers.CopyToOutputRegisters();
       return IrregexpInterpreter::SUCCESS;
     }
@@ -1112,6 +1118,25 @@ IrregexpInterpreter::Result RawMatch(
 #undef BC_LABEL
 #undef V8_USE_COMPUTED_GOTO
 
+// Regexps that backtrack a lot are slow in the interpreter regardless of their
+// execution count or subject length, so tier them up on the next execution.
+void MaybeTierUpOnBacktracks(Tagged<IrRegExpData> regexp_data,
+                             uint32_t backtrack_count) {
+  if (v8_flags.regexp_tier_up_backtracks <= 0 ||
+      backtrack_count <
+          static_cast<uint32_t>(v8_flags.regexp_tier_up_backtracks) ||
+      !regexp_data->CanTierUp() || regexp_data->MarkedForTierUp()) {
+    return;
+  }
+  regexp_data->MarkTierUpForNextExec();
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF(
+        "Forcing tier-up of RegExpData object %p after %u backtracks in the "
+        "interpreter\n",
+        reinterpret_cast<void*>(regexp_data->ptr()), backtrack_count);
+  }
+}
+
 }  // namespace
 
 // static
@@ -1120,8 +1145,10 @@ int IrregexpInterpreter::Match(Isolate* isolate,
                                Tagged<String> subject_string,
                                int* output_registers, int output_register_count,
                                int start_position,
-                               RegExp::CallOrigin call_origin) {
+                               RegExp::CallOrigin call_origin,
+                               uint32_t* backtrack_count) {
   if (v8_flags.regexp_tier_up) regexp_data->TierUpTick();
+  *backtrack_count = 0;
 
   bool is_any_unicode =
       IsEitherUnicode(JSRegExp::AsRegExpFlags(regexp_data->flags()));
@@ -1143,10 +1170,12 @@ int IrregexpInterpreter::Match(Isolate* isolate,
   int num_matches = 0;
   int* current_output_registers = output_registers;
   for (int i = 0; i < number_of_matches_in_output_registers; i++) {
+    uint32_t current_backtrack_count = 0;
     auto current_result = MatchInternal(
         isolate, &code_array, &subject_string, current_output_registers,
         registers_per_match, total_register_count, start_position, call_origin,
-        backtrack_limit);
+        backtrack_limit, &current_backtrack_count);
+    *backtrack_count += current_backtrack_count;
 
     if (current_result == SUCCESS) {
       // Fall through.
@@ -1185,7 +1214,8 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     Isolate* isolate, Tagged<TrustedByteArray>* code_array,
     Tagged<String>* subject_string, int* output_registers,
     int output_register_count, int total_register_count, int start_position,
-    RegExp::CallOrigin call_origin, uint32_t backtrack_limit) {
+    RegExp::CallOrigin call_origin, uint32_t backtrack_limit,
+    uint32_t* backtrack_count) {
   DCHECK((*subject_string)->IsFlat());
 
   // Note: Heap allocation *is* allowed in two situations if calling from
@@ -1210,7 +1240,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   } else {
     DCHECK(subject_content.IsTwoByte());
     base::Vector<const base::uc16> subject_vector =
@@ -1219,7 +1249,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   }
 }
 
@@ -1257,8 +1287,13 @@ int IrregexpInterpreter::MatchForCallFromJs(
     return IrregexpInterpreter::RETRY;
   }
 
-  return Match(isolate, regexp_data_obj, subject_string, output_registers,
-               output_register_count, start_position, call_origin);
+  uint32_t backtrack_count;
+  int result =
+      Match(isolate, regexp_data_obj, subject_string, output_registers,
+            output_register_count, start_position, call_origin,
+            &backtrack_count);
+  MaybeTierUpOnBacktracks(regexp_data_obj, backtrack_count);
+  return result;
 }
 
 #endif  // !COMPILING_IRREGEXP_FOR_EXTERNAL_EMBEDDER
@@ -1267,9 +1302,14 @@ int IrregexpInterpreter::MatchForCallFromRuntime(
     Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
     DirectHandle<String> subject_string, int* output_registers,
     int output_register_count, int start_position) {
-  return Match(isolate, *regexp_data, *subject_string, output_registers,
-               output_register_count, start_position,
-               RegExp::CallOrigin::kFromRuntime);
+  uint32_t backtrack_count;
+  int result = Match(isolate, *regexp_data, *subject_string, output_registers,
+                     output_register_count, start_position,
+                     RegExp::CallOrigin::kFromRuntime, &backtrack_count);
+  // Interrupts may have moved the data object during the match, so use the
+  // handle rather than the raw object passed to Match.
+  MaybeTierUpOnBacktracks(*regexp_data, backtrack_count);
+  return result;
 }
 
 }  // namespace internal
@@ -59,13 +59,14 @@ class V8_EXPORT_PRIVATE IrregexpInterpreter : public AllStatic {
                               int* output_registers, int output_register_count,
                               int total_register_count, int start_position,
                               RegExp::CallOrigin call_origin,
-                              uint32_t backtrack_limit);
+                              uint32_t backtrack_limit,
+                              uint32_t* backtrack_count = nullptr);
 
  private:
   static int Match(Isolate* isolate, Tagged<IrRegExpData> regexp_data,
                    Tagged<String> subject_string, int* output_registers,
                    int output_register_count, int start_position,
-                   RegExp::CallOrigin call_origin);
+                   RegExp::CallOrigin call_origin, uint32_t* backtrack_count);
 };
 
 }  // namespace internal
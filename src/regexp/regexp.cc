@@ -4,6 +4,13 @@
 
 #include "src/regexp/regexp.h"
 
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
@@ -23,6 +30,7 @@
 #include "src/regexp/regexp-stack.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -654,6 +662,120 @@ DirectHandle<FixedArray> RegExp::CreateCaptureNameMap(
   return array;
 }
 
+namespace {
+
+// Returns the backtrack limit to compile `re_data` with, and whether the
+// generated code may fall back to the experimental engine on excessive
+// backtracking.
+uint32_t BacktrackLimitForCompilation(DirectHandle<IrRegExpData> re_data,
+                                      bool* can_fallback) {
+  uint32_t backtrack_limit = re_data->backtrack_limit();
+  *can_fallback =
+      v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks &&
+      re_data->is_linear_executable();
+  if (*can_fallback) {
+    if (backtrack_limit == JSRegExp::kNoBacktrackLimit) {
+      backtrack_limit = v8_flags.regexp_backtracks_before_fallback;
+    } else {
+      backtrack_limit = std::min(
+          backtrack_limit, v8_flags.regexp_backtracks_before_fallback.value());
+    }
+  }
+  return backtrack_limit;
+}
+
+// A process-wide cache of irregexp bytecode shared by all isolates. Bytecode
+// doesn't reference any heap objects, so the bytecode compiled for a pattern
+// in one isolate can be copied into any other isolate, which then only needs
+// to parse the pattern. Entries are never evicted; once the cache reaches its
+// size limit, new bytecode is no longer added.
+class SharedRegExpBytecodeCache final {
+ public:
+  static SharedRegExpBytecodeCache* Get() {
+    static base::LeakyObject<SharedRegExpBytecodeCache> cache;
+    return cache.get();
+  }
+
+  bool Lookup(Isolate* isolate, DirectHandle<IrRegExpData> re_data,
+              DirectHandle<String> pattern, bool is_one_byte,
+              RegExpCompileData* compile_data) {
+    const Key key = MakeKey(re_data, pattern, is_one_byte);
+    base::OwnedVector<uint8_t> cached_bytecode;
+    int register_count;
+    {
+      // The bytecode is copied out before allocating, as allocation may
+      // trigger a GC, which can't reach a safepoint with a shared heap while
+      // other isolates wait for this lock.
+      base::MutexGuard guard(&mutex_);
+      auto it = entries_.find(key);
+      if (it == entries_.end()) return false;
+      const Entry& entry = it->second;
+      cached_bytecode = base::OwnedCopyOf(entry.bytecode);
+      register_count = entry.register_count;
+    }
+
+    DirectHandle<TrustedByteArray> bytecode =
+        isolate->factory()->NewTrustedByteArray(
+            static_cast<int>(cached_bytecode.size()));
+    MemCopy(bytecode->begin(), cached_bytecode.begin(),
+            cached_bytecode.size());
+    compile_data->code = bytecode;
+    compile_data->register_count = register_count;
+    if (std::get<kCanFallback>(key)) {
+      re_data->set_backtrack_limit(std::get<kBacktrackLimit>(key));
+    }
+    return true;
+  }
+
+  void Insert(DirectHandle<IrRegExpData> re_data, DirectHandle<String> pattern,
+              bool is_one_byte, const RegExpCompileData& compile_data) {
+    Tagged<TrustedByteArray> bytecode =
+        SbxCast<TrustedByteArray>(*compile_data.code);
+    const size_t size = bytecode->length();
+    Key key = MakeKey(re_data, pattern, is_one_byte);
+    base::MutexGuard guard(&mutex_);
+    if (size_ + size > kMaxSize) return;
+    Entry entry{std::vector<uint8_t>(bytecode->begin(), bytecode->end()),
+                compile_data.register_count};
+    if (entries_.emplace(std::move(key), std::move(entry)).second) {
+      size_ += size;
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxSize = 4 * MB;
+
+  // Source, flags, one-byte subject, backtrack limit and experimental engine
+  // fallback.
+  using Key = std::tuple<std::u16string, int, bool, uint32_t, bool>;
+  static constexpr int kBacktrackLimit = 3;
+  static constexpr int kCanFallback = 4;
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+  };
+
+  static Key MakeKey(DirectHandle<IrRegExpData> re_data,
+                     DirectHandle<String> pattern, bool is_one_byte) {
+    DCHECK(pattern->IsFlat());
+    std::u16string source(pattern->length(), u'\0');
+    String::WriteToFlat(*pattern, reinterpret_cast<base::uc16*>(source.data()),
+                        0, pattern->length());
+    bool can_fallback;
+    uint32_t backtrack_limit =
+        BacktrackLimitForCompilation(re_data, &can_fallback);
+    return Key(std::move(source), static_cast<int>(re_data->flags()),
+               is_one_byte, backtrack_limit, can_fallback);
+  }
+
+  base::Mutex mutex_;
+  std::map<Key, Entry> entries_;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexpFromSource(Isolate* isolate,
                                            DirectHandle<IrRegExpData> re_data,
                                            DirectHandle<String> sample_subject,
@@ -700,9 +822,22 @@ bool RegExpImpl::CompileIrregexpFromSource(Isolate* isolate,
   compile_data.compilation_target = re_data->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              re_data, is_one_byte);
+  const bool use_shared_bytecode_cache =
+      v8_flags.regexp_shared_bytecode_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode;
+  bool compilation_succeeded =
+      use_shared_bytecode_cache &&
+      SharedRegExpBytecodeCache::Get()->Lookup(isolate, re_data, pattern,
+                                               is_one_byte, &compile_data);
+  if (!compilation_succeeded) {
+    compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                re_data, is_one_byte);
+    if (compilation_succeeded && use_shared_bytecode_cache) {
+      SharedRegExpBytecodeCache::Get()->Insert(re_data, pattern, is_one_byte,
+                                               compile_data);
+    }
+  }
   if (!compilation_succeeded) {
     DCHECK(compile_data.error != RegExpError::kNone);
     RegExp::ThrowRegExpException(isolate, re_data, compile_data.error);
@@ -802,22 +937,12 @@ std::unique_ptr<RegExpMacroAssembler> CreateNativeMacroAssembler(
 
 void SetBacktrackAndExperimentalFallback(RegExpMacroAssembler* macro_assembler,
                                          DirectHandle<IrRegExpData> re_data) {
-  uint32_t backtrack_limit = re_data->backtrack_limit();
-  if (v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks &&
-      re_data->is_linear_executable()) {
-    if (backtrack_limit == JSRegExp::kNoBacktrackLimit) {
-      backtrack_limit = v8_flags.regexp_backtracks_before_fallback;
-    } else {
-      backtrack_limit = std::min(
-          backtrack_limit, v8_flags.regexp_backtracks_before_fallback.value());
-    }
-    re_data->set_backtrack_limit(backtrack_limit);
-    macro_assembler->set_backtrack_limit(backtrack_limit);
-    macro_assembler->set_can_fallback(true);
-  } else {
-    macro_assembler->set_backtrack_limit(backtrack_limit);
-    macro_assembler->set_can_fallback(false);
-  }
+  bool can_fallback;
+  uint32_t backtrack_limit =
+      BacktrackLimitForCompilation(re_data, &can_fallback);
+  if (can_fallback) re_data->set_backtrack_limit(backtrack_limit);
+  macro_assembler->set_backtrack_limit(backtrack_limit);
+  macro_assembler->set_can_fallback(can_fallback);
 }
 
 }  // namespace
@@ -1025,12 +1150,20 @@ std::optional<int> RegExpImpl::IrregexpExec(
 
   // Maybe force early tier up:
   if (v8_flags.regexp_tier_up) {
-    if (subject->length() >= JSRegExp::kTierUpForSubjectLengthValue) {
+    // Computed in 64 bits, as the product can overflow for long patterns.
+    const uint64_t tier_up_subject_length = std::max<uint64_t>(
+        JSRegExp::kTierUpForSubjectLengthValue,
+        uint64_t{regexp_data->source()->length()} *
+            JSRegExp::kTierUpForSubjectLengthPerPatternCharacter);
+    if (subject->length() >= tier_up_subject_length) {
       // For very long subject strings, the regexp interpreter is currently much
       // slower than the jitted code execution. If the tier-up strategy is
       // turned on, we want to avoid this performance penalty so we eagerly
       // tier-up if the subject string length is equal or greater than the given
-      // heuristic value.
+      // heuristic value. The value scales with the pattern length so that
+      // large one-off regexps don't pay for native compilation on the first
+      // long subject; they still tier up through the execution ticks or the
+      // interpreter's backtrack count.
       regexp_data->MarkTierUpForNextExec();
       if (v8_flags.trace_regexp_tier_up) {
         PrintF(
@@ -2,11 +2,17 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-inl.h"
@@ -206,6 +212,114 @@ RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
       isolate, Object::ArraySpeciesConstructor(isolate, original_array));
 }
 
+namespace {
+
+enum class NumericSortOrder { kNone, kAscending, kDescending };
+
+// Recognizes comparison functions of the form (a, b) => a - b and
+// (a, b) => b - a, i.e. functions whose bytecode is exactly
+//
+//   Ldar <b>; Sub <a>; Return    (ascending)
+//   Ldar <a>; Sub <b>; Return    (descending)
+//
+// For numbers these have no side effects, so calling them can be skipped as
+// long as nothing (e.g. the debugger or code coverage) observes the calls.
+NumericSortOrder GetNumericSortOrder(Isolate* isolate,
+                                     Tagged<Object> comparefn) {
+  if (!IsJSFunction(comparefn)) return NumericSortOrder::kNone;
+  Tagged<SharedFunctionInfo> shared = Cast<JSFunction>(comparefn)->shared();
+  if (shared->internal_formal_parameter_count_without_receiver() != 2 ||
+      !shared->HasBytecodeArray() || isolate->debug()->is_active() ||
+      !isolate->is_best_effort_code_coverage()) {
+    return NumericSortOrder::kNone;
+  }
+
+  interpreter::BytecodeArrayIterator it(
+      handle(shared->GetBytecodeArray(isolate), isolate));
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return NumericSortOrder::kNone;
+  }
+  interpreter::Register lhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return NumericSortOrder::kNone;
+  }
+  interpreter::Register rhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return NumericSortOrder::kNone;
+  }
+
+  // Sub computes <register> - <accumulator>.
+  if (rhs == it.GetParameter(0) && lhs == it.GetParameter(1)) {
+    return NumericSortOrder::kAscending;
+  }
+  if (rhs == it.GetParameter(1) && lhs == it.GetParameter(0)) {
+    return NumericSortOrder::kDescending;
+  }
+  return NumericSortOrder::kNone;
+}
+
+template <typename T>
+void SortNumbers(std::vector<T>& values, NumericSortOrder order) {
+  // Array.prototype.sort is stable, which is observable for -0 and +0.
+  if (order == NumericSortOrder::kAscending) {
+    std::stable_sort(values.begin(), values.end(), std::less<T>());
+  } else {
+    DCHECK_EQ(order, NumericSortOrder::kDescending);
+    std::stable_sort(values.begin(), values.end(), std::greater<T>());
+  }
+}
+
+}  // namespace
+
+// Sorts a packed Smi or double array in place without calling {comparefn} if
+// the latter is a plain numeric comparison. Returns false if the array has to
+// be sorted by the generic Array.prototype.sort instead.
+RUNTIME_FUNCTION(Runtime_ArraySortNumeric) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  DirectHandle<JSArray> array = args.at<JSArray>(0);
+  NumericSortOrder order = GetNumericSortOrder(isolate, args[1]);
+  ElementsKind kind = array->GetElementsKind();
+  if (order == NumericSortOrder::kNone ||
+      (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS)) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+
+  JSObject::EnsureWritableFastElements(isolate, array);
+  DisallowGarbageCollection no_gc;
+  int length = Smi::ToInt(array->length());
+  if (kind == PACKED_SMI_ELEMENTS) {
+    Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
+    CHECK_LE(length, elements->length());
+    std::vector<int> values(length);
+    for (int i = 0; i < length; ++i) {
+      values[i] = Smi::ToInt(elements->get(i));
+    }
+    SortNumbers(values, order);
+    for (int i = 0; i < length; ++i) {
+      elements->set(i, Smi::FromInt(values[i]), SKIP_WRITE_BARRIER);
+    }
+  } else {
+    Tagged<FixedDoubleArray> elements =
+        Cast<FixedDoubleArray>(array->elements());
+    CHECK_LE(length, elements->length());
+    std::vector<double> values(length);
+    for (int i = 0; i < length; ++i) {
+      values[i] = elements->get_scalar(i);
+      // The comparison function is inconsistent for NaN, leave the resulting
+      // order to the generic sort.
+      if (std::isnan(values[i])) return ReadOnlyRoots(isolate).false_value();
+    }
+    SortNumbers(values, order);
+    for (int i = 0; i < length; ++i) {
+      elements->set(i, values[i]);
+    }
+  }
+  return ReadOnlyRoots(isolate).true_value();
+}
+
 // ES7 22.1.3.11 Array.prototype.includes
 RUNTIME_FUNCTION(Runtime_ArrayIncludes_Slow) {
   HandleScope shs(isolate);
@@ -618,7 +618,8 @@ Tagged<Object> CompileOptimizedOSR(Isolate* isolate,
           ? ConcurrencyMode::kConcurrent
           : ConcurrencyMode::kSynchronous;
 
-  if (V8_UNLIKELY(isolate->EfficiencyModeEnabled() &&
+  if (V8_UNLIKELY(v8_flags.efficiency_mode_synchronous_maglev &&
+                  isolate->EfficiencyModeEnabled() &&
                   min_opt_level == CodeKind::MAGLEV)) {
     mode = ConcurrencyMode::kSynchronous;
   }
@@ -567,31 +567,26 @@ void TruncateRegexpIndicesList(Isolate* isolate) {
 }
 }  // namespace
 
+// Replaces the matches of a pattern of length |pattern_len| at |indices| in
+// |subject| with |replacement|, writing the result into a single string of the
+// final length.
 template <typename ResultSeqString>
-V8_WARN_UNUSED_RESULT static Tagged<UnionOf<ExceptionHole, String>>
-StringReplaceGlobalAtomRegExpWithString(
-    Isolate* isolate, DirectHandle<String> subject,
-    DirectHandle<JSRegExp> pattern_regexp, DirectHandle<String> replacement,
-    DirectHandle<RegExpMatchInfo> last_match_info,
-    DirectHandle<AtomRegExpData> regexp_data) {
+V8_WARN_UNUSED_RESULT static MaybeDirectHandle<String>
+ReplaceStringIndicesWithString(Isolate* isolate, DirectHandle<String> subject,
+                               int pattern_len,
+                               DirectHandle<String> replacement,
+                               const std::vector<int>& indices) {
   DCHECK(subject->IsFlat());
   DCHECK(replacement->IsFlat());
+  DCHECK(!indices.empty());
 
-  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
-
-  Tagged<String> pattern = regexp_data->pattern();
   int subject_len = subject->length();
-  int pattern_len = pattern->length();
   int replacement_len = replacement->length();
 
-  FindStringIndicesDispatch(isolate, *subject, pattern, indices, 0xFFFFFFFF);
-
-  if (indices->empty()) return *subject;
-
   // Detect integer overflow.
   int64_t result_len_64 = (static_cast<int64_t>(replacement_len) -
                            static_cast<int64_t>(pattern_len)) *
-                              static_cast<int64_t>(indices->size()) +
+                              static_cast<int64_t>(indices.size()) +
                           static_cast<int64_t>(subject_len);
   int result_len;
   if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
@@ -601,7 +596,7 @@ StringReplaceGlobalAtomRegExpWithString(
     result_len = static_cast<int>(result_len_64);
   }
   if (result_len == 0) {
-    return ReadOnlyRoots(isolate).empty_string();
+    return isolate->factory()->empty_string();
   }
 
   int subject_pos = 0;
@@ -614,11 +609,11 @@ StringReplaceGlobalAtomRegExpWithString(
     maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
   }
   DirectHandle<SeqString> untyped_res;
-  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, untyped_res, maybe_res);
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, untyped_res, maybe_res);
   DirectHandle<ResultSeqString> result = Cast<ResultSeqString>(untyped_res);
 
   DisallowGarbageCollection no_gc;
-  for (int index : *indices) {
+  for (int index : indices) {
     // Copy non-matched subject content.
     if (subject_pos < index) {
       String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
@@ -640,6 +635,34 @@ StringReplaceGlobalAtomRegExpWithString(
     String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
                         subject_pos, subject_len - subject_pos);
   }
+  return result;
+}
+
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Tagged<UnionOf<ExceptionHole, String>>
+StringReplaceGlobalAtomRegExpWithString(
+    Isolate* isolate, DirectHandle<String> subject,
+    DirectHandle<JSRegExp> pattern_regexp, DirectHandle<String> replacement,
+    DirectHandle<RegExpMatchInfo> last_match_info,
+    DirectHandle<AtomRegExpData> regexp_data) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+
+  Tagged<String> pattern = regexp_data->pattern();
+  int pattern_len = pattern->length();
+
+  FindStringIndicesDispatch(isolate, *subject, pattern, indices, 0xFFFFFFFF);
+
+  if (indices->empty()) return *subject;
+
+  DirectHandle<String> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result,
+      ReplaceStringIndicesWithString<ResultSeqString>(
+          isolate, subject, pattern_len, replacement, *indices));
+  if (result->length() == 0) return *result;
 
   int32_t match_indices[] = {indices->back(), indices->back() + pattern_len};
   RegExp::SetLastMatchInfo(isolate, last_match_info, subject, 0, match_indices);
@@ -838,6 +861,45 @@ StringReplaceGlobalRegExpWithEmptyString(
   return *answer;
 }
 
+// Implements String.prototype.replaceAll for a non-empty search string and a
+// replacement string without substitution patterns.
+RUNTIME_FUNCTION(Runtime_StringReplaceAllWithString) {
+  HandleScope handle_scope(isolate);
+  DCHECK_EQ(3, args.length());
+  DirectHandle<String> subject = args.at<String>(0);
+  DirectHandle<String> search = args.at<String>(1);
+  DirectHandle<String> replacement = args.at<String>(2);
+  CHECK_LT(0, search->length());
+
+  subject = String::Flatten(isolate, subject);
+  search = String::Flatten(isolate, search);
+  replacement = String::Flatten(isolate, replacement);
+
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+
+  FindStringIndicesDispatch(isolate, *subject, *search, indices, 0xFFFFFFFF);
+
+  if (indices->empty()) return *subject;
+
+  DirectHandle<String> result;
+  if (subject->IsOneByteRepresentation() &&
+      replacement->IsOneByteRepresentation()) {
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result,
+        ReplaceStringIndicesWithString<SeqOneByteString>(
+            isolate, subject, search->length(), replacement, *indices));
+  } else {
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result,
+        ReplaceStringIndicesWithString<SeqTwoByteString>(
+            isolate, subject, search->length(), replacement, *indices));
+  }
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 RUNTIME_FUNCTION(Runtime_StringSplit) {
   HandleScope handle_scope(isolate);
   DCHECK_EQ(3, args.length());
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -11,7 +13,6 @@
 #include "src/objects/objects-inl.h"
 #include "src/runtime/runtime-utils.h"
 #include "src/runtime/runtime.h"
-#include "third_party/fp16/src/include/fp16.h"
 
 namespace v8 {
 namespace internal {
@@ -78,27 +79,39 @@ RUNTIME_FUNCTION(Runtime_GrowableSharedArrayBufferByteLength) {
 
 namespace {
 
-template <typename T>
-bool CompareNum(T x, T y) {
-  if (x < y) {
-    return true;
-  } else if (x > y) {
-    return false;
-  } else if (!std::is_integral_v<T>) {
-    double _x = x, _y = y;
-    if (x == 0 && x == y) {
-      /* -0.0 is less than +0.0 */
-      return std::signbit(_x) && !std::signbit(_y);
-    } else if (!std::isnan(_x) && std::isnan(_y)) {
-      /* number is less than NaN */
-      return true;
-    }
+// Sorts floating-point values, given by their raw IEEE bits, in the order
+// required by TypedArray.prototype.sort (-0 before +0, NaNs last). The bits are
+// mapped to unsigned keys whose integer order matches that order, which is a
+// lot cheaper to compare than the floating-point values (in particular for
+// Float16, which would otherwise be converted on every comparison).
+template <typename Bits, Bits kInfinityBits, typename Iterator>
+void SortFloatBits(Iterator begin, Iterator end) {
+  static_assert(std::is_unsigned_v<Bits>);
+  constexpr Bits kSignBit = Bits{1} << (sizeof(Bits) * kBitsPerByte - 1);
+  Iterator numbers_end = std::partition(begin, end, [](Bits bits) {
+    return static_cast<Bits>(bits & ~kSignBit) <= kInfinityBits;
+  });
+  for (Iterator it = begin; it != numbers_end; ++it) {
+    Bits bits = *it;
+    *it = static_cast<Bits>((bits & kSignBit) ? ~bits : (bits | kSignBit));
+  }
+  std::sort(begin, numbers_end);
+  for (Iterator it = begin; it != numbers_end; ++it) {
+    Bits key = *it;
+    *it = static_cast<Bits>((key & kSignBit) ? (key & ~kSignBit) : ~key);
   }
-  return false;
 }
 
-bool LessThanFloat16RawBits(uint16_t x, uint16_t y) {
-  return CompareNum(fp16_ieee_to_fp32_value(x), fp16_ieee_to_fp32_value(y));
+template <typename Bits, Bits kInfinityBits>
+void SortFloats(void* data, size_t length) {
+  Bits* bits = static_cast<Bits*>(data);
+  if (COMPRESS_POINTERS_BOOL && alignof(Bits) > kTaggedSize) {
+    // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+    SortFloatBits<Bits, kInfinityBits>(UnalignedSlot<Bits>(bits),
+                                       UnalignedSlot<Bits>(bits + length));
+  } else {
+    SortFloatBits<Bits, kInfinityBits>(bits, bits + length);
+  }
 }
 
 }  // namespace
@@ -164,18 +177,12 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)        \
                             : static_cast<ctype*>(array->DataPtr());         \
     size_t length = byte_length / sizeof(ctype);                             \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                   \
-        kExternal##Type##Array == kExternalFloat32Array) {                   \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {          \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */       \
-        std::sort(UnalignedSlot<ctype>(data),                                \
-                  UnalignedSlot<ctype>(data + length), CompareNum<ctype>);   \
-      } else {                                                               \
-        std::sort(data, data + length, CompareNum<ctype>);                   \
-      }                                                                      \
+    if (kExternal##Type##Array == kExternalFloat64Array) {                   \
+      SortFloats<uint64_t, 0x7FF0000000000000>(data, length);                \
+    } else if (kExternal##Type##Array == kExternalFloat32Array) {            \
+      SortFloats<uint32_t, 0x7F800000>(data, length);                        \
     } else if (kExternal##Type##Array == kExternalFloat16Array) {            \
-      DCHECK_IMPLIES(COMPRESS_POINTERS_BOOL, alignof(ctype) <= kTaggedSize); \
-      std::sort(data, data + length, LessThanFloat16RawBits);                \
+      SortFloats<uint16_t, 0x7C00>(data, length);                            \
     } else {                                                                 \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {          \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */       \
@@ -50,6 +50,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArraySortNumeric, 2, 1)            \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -466,6 +467,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(RegExpReplaceRT, 3, 1)                          \
   F(RegExpSplit, 3, 1)                              \
   F(RegExpStringFromFlags, 1, 1)                    \
+  F(StringReplaceAllWithString, 3, 1)               \
   F(StringReplaceNonGlobalRegExpWithFunction, 3, 1) \
   F(StringSplit, 3, 1)                              \
   F(RegExpExec, 4, 1)                               \
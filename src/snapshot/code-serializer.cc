@@ -79,10 +79,20 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   }
 
   HandleScope scope(isolate);
+  // Allocate the replacement data for lazy functions up front, as the
+  // serializer must not cause GCs.
+  LazyFunctionMap lazy_functions;
+  if (v8_flags.code_cache_lazy_functions) {
+    lazy_functions = CollectLazyFunctions(isolate, script);
+  }
   CodeSerializer cs(isolate,
                     SerializedCodeData::SourceHash(source, wrapped_arguments,
                                                    script->origin_options()));
   DisallowGarbageCollection no_gc;
+  cs.lazy_functions_ = std::move(lazy_functions);
+  if (!cs.lazy_functions_.empty()) {
+    cs.lazy_functions_script_ = indirect_handle(script, isolate);
+  }
 
 #ifndef DEBUG
   cs.reference_map()->AddAttachedReference(*source);
@@ -104,6 +114,39 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   return result;
 }
 
+// static
+CodeSerializer::LazyFunctionMap CodeSerializer::CollectLazyFunctions(
+    Isolate* isolate, DirectHandle<Script> script) {
+  // Allocating the replacement data below can GC, so the candidates are held
+  // in indirect handles and are keyed by a value that does not move.
+  std::vector<IndirectHandle<SharedFunctionInfo>> candidates;
+  {
+    DisallowGarbageCollection no_gc;
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (Tagged<SharedFunctionInfo> sfi = iter.Next(); !sfi.is_null();
+         sfi = iter.Next()) {
+      // Only plain bytecode of inner functions which would be subject to
+      // bytecode flushing is omitted.
+      if (sfi->is_toplevel() || !sfi->HasBytecodeArray() ||
+          sfi->HasBaselineCode() || sfi->HasInterpreterData(isolate) ||
+          !sfi->CanDiscardCompiled() || sfi->HasDebugInfo(isolate) ||
+          sfi->age() < v8_flags.bytecode_old_age) {
+        continue;
+      }
+      candidates.push_back(handle(sfi, isolate));
+    }
+  }
+  LazyFunctionMap result;
+  for (IndirectHandle<SharedFunctionInfo> sfi : candidates) {
+    DirectHandle<UncompiledData> data =
+        isolate->factory()->NewUncompiledDataWithoutPreparseData(
+            direct_handle(sfi->inferred_name(), isolate), sfi->StartPosition(),
+            sfi->EndPosition());
+    result.emplace(sfi->function_literal_id(), indirect_handle(data, isolate));
+  }
+  return result;
+}
+
 AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
   DisallowGarbageCollection no_gc;
@@ -170,9 +213,26 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     DirectHandle<DebugInfo> debug_info;
     CachedTieringDecision cached_tiering_decision;
     bool restore_bytecode = false;
+    DirectHandle<BytecodeArray> lazy_bytecode;
+    DirectHandle<FeedbackMetadata> lazy_feedback_metadata;
     {
       DisallowGarbageCollection no_gc;
       Tagged<SharedFunctionInfo> sfi = Cast<SharedFunctionInfo>(*obj);
+      auto lazy_function = lazy_functions_.end();
+      if (!lazy_functions_.empty() &&
+          sfi->script() == *lazy_functions_script_) {
+        lazy_function = lazy_functions_.find(sfi->function_literal_id());
+      }
+      if (lazy_function != lazy_functions_.end()) {
+        // Serialize the function as if its bytecode had been flushed.
+        DCHECK(sfi->HasBytecodeArray());
+        lazy_bytecode = direct_handle(sfi->GetBytecodeArray(isolate()),
+                                      isolate());
+        lazy_feedback_metadata =
+            direct_handle(sfi->feedback_metadata(), isolate());
+        sfi->DiscardCompiledMetadata(isolate());
+        sfi->set_uncompiled_data(*lazy_function->second);
+      }
       DCHECK(!sfi->IsApiFunction());
 #if V8_ENABLE_WEBASSEMBLY
       // TODO(7110): Enable serializing of Asm modules once the AsmWasmData
@@ -191,7 +251,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       }
       if (v8_flags.profile_guided_optimization) {
         cached_tiering_decision = sfi->cached_tiering_decision();
-        if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
+        // Optimized code is never cached, but the tiering decision is a
+        // cheap, always valid hint about how the previous run used this
+        // function. Unless requested, only keep the fact that it was used.
+        if (!v8_flags.profile_guided_optimization_in_code_cache &&
+            cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
           sfi->set_cached_tiering_decision(
               CachedTieringDecision::kEarlySparkplug);
         }
@@ -204,6 +268,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       sfi->SetActiveBytecodeArray(debug_info->DebugBytecodeArray(isolate()),
                                   isolate());
     }
+    if (!lazy_bytecode.is_null()) {
+      sfi->set_raw_outer_scope_info_or_feedback_metadata(
+          *lazy_feedback_metadata);
+      sfi->set_bytecode_array(*lazy_bytecode);
+    }
     if (v8_flags.profile_guided_optimization &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
@@ -913,5 +982,84 @@ SerializedCodeData SerializedCodeData::FromPartiallySanityCheckedCachedData(
   return scd;
 }
 
+namespace {
+
+uint32_t ReadBundleValue(const uint8_t* bundle, uint32_t offset) {
+  return base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(bundle) + offset);
+}
+
+void WriteBundleValue(uint8_t* bundle, uint32_t offset, uint32_t value) {
+  base::WriteLittleEndianValue(reinterpret_cast<Address>(bundle) + offset,
+                               value);
+}
+
+}  // namespace
+
+// static
+ScriptCompiler::CachedData* CodeCacheBundle::Create(
+    base::Vector<const ScriptCompiler::CachedData* const> entries) {
+  const uint32_t count = static_cast<uint32_t>(entries.size());
+  const uint32_t index_end = kIndexOffset + count * kIndexEntrySize;
+  size_t size = POINTER_SIZE_ALIGN(index_end);
+  for (const ScriptCompiler::CachedData* entry : entries) {
+    CHECK_GE(entry->length, 0);
+    size = POINTER_SIZE_ALIGN(size + entry->length);
+  }
+  CHECK_LE(size, kMaxUInt32);
+
+  uint8_t* data = NewArray<uint8_t>(size);
+  memset(data, 0, size);
+  WriteBundleValue(data, kMagicNumberOffset, kMagicNumber);
+  WriteBundleValue(data, kVersionHashOffset, Version::Hash());
+  WriteBundleValue(data, kEntryCountOffset, count);
+  uint32_t offset = static_cast<uint32_t>(POINTER_SIZE_ALIGN(index_end));
+  for (uint32_t i = 0; i < count; i++) {
+    const ScriptCompiler::CachedData* entry = entries[i];
+    const uint32_t length = static_cast<uint32_t>(entry->length);
+    WriteBundleValue(data, kIndexOffset + i * kIndexEntrySize, offset);
+    WriteBundleValue(data, kIndexOffset + i * kIndexEntrySize + kUInt32Size,
+                     length);
+    CopyBytes(data + offset, entry->data, length);
+    offset = static_cast<uint32_t>(POINTER_SIZE_ALIGN(offset + length));
+  }
+  DCHECK_EQ(offset, size);
+  // Only the index is checksummed; entries carry their own checksum which is
+  // verified when they are consumed.
+  WriteBundleValue(data, kIndexChecksumOffset,
+                   Checksum(base::Vector<const uint8_t>(
+                       data + kIndexOffset, index_end - kIndexOffset)));
+  return new ScriptCompiler::CachedData(
+      data, static_cast<int>(size),
+      ScriptCompiler::CachedData::BufferOwned);
+}
+
+// static
+base::Vector<const uint8_t> CodeCacheBundle::GetEntry(
+    base::Vector<const uint8_t> bundle, size_t index) {
+  if (bundle.size() < kIndexOffset) return {};
+  const uint8_t* data = bundle.begin();
+  if (ReadBundleValue(data, kMagicNumberOffset) != kMagicNumber) return {};
+  if (ReadBundleValue(data, kVersionHashOffset) != Version::Hash()) return {};
+  const uint32_t count = ReadBundleValue(data, kEntryCountOffset);
+  if (count > (bundle.size() - kIndexOffset) / kIndexEntrySize) return {};
+  if (index >= count) return {};
+  const uint32_t index_end = kIndexOffset + count * kIndexEntrySize;
+  if (Checksum(base::Vector<const uint8_t>(data + kIndexOffset,
+                                           index_end - kIndexOffset)) !=
+      ReadBundleValue(data, kIndexChecksumOffset)) {
+    return {};
+  }
+  const uint32_t entry_offset =
+      kIndexOffset + static_cast<uint32_t>(index) * kIndexEntrySize;
+  const uint32_t offset = ReadBundleValue(data, entry_offset);
+  const uint32_t length = ReadBundleValue(data, entry_offset + kUInt32Size);
+  if (offset < index_end || offset > bundle.size() ||
+      length > bundle.size() - offset) {
+    return {};
+  }
+  return bundle.SubVector(offset, offset + length);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_map>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -107,8 +109,18 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  // Inner functions of the serialized script which are serialized as
+  // uncompiled, keyed by their function literal id (see
+  // --code-cache-lazy-functions).
+  using LazyFunctionMap =
+      std::unordered_map<int, IndirectHandle<UncompiledData>>;
+  static LazyFunctionMap CollectLazyFunctions(Isolate* isolate,
+                                              DirectHandle<Script> script);
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  LazyFunctionMap lazy_functions_;
+  IndirectHandle<Script> lazy_functions_script_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -175,6 +187,34 @@ class SerializedCodeData : public SerializedData {
       uint32_t expected_ro_snapshot_checksum) const;
 };
 
+// A collection of code caches of multiple scripts in a single buffer. The
+// layout consists of uint32_t-sized entries:
+//   magic number, version hash, entry count, index checksum,
+//   (offset, length) per entry,
+// followed by the entries' SerializedCodeData at pointer-aligned offsets.
+class V8_EXPORT_PRIVATE CodeCacheBundle {
+ public:
+  static constexpr uint32_t kMagicNumber = 0xC0DEB0D1;
+  static constexpr uint32_t kMagicNumberOffset = 0;
+  static constexpr uint32_t kVersionHashOffset =
+      kMagicNumberOffset + kUInt32Size;
+  static constexpr uint32_t kEntryCountOffset =
+      kVersionHashOffset + kUInt32Size;
+  static constexpr uint32_t kIndexChecksumOffset =
+      kEntryCountOffset + kUInt32Size;
+  static constexpr uint32_t kIndexOffset = kIndexChecksumOffset + kUInt32Size;
+  static constexpr uint32_t kIndexEntrySize = 2 * kUInt32Size;
+
+  // Returns a newly allocated bundle of |entries|, which the caller owns.
+  static ScriptCompiler::CachedData* Create(
+      base::Vector<const ScriptCompiler::CachedData* const> entries);
+
+  // Returns the bytes of the entry at |index|, or an empty vector if the
+  // bundle is malformed or |index| is out of range.
+  static base::Vector<const uint8_t> GetEntry(
+      base::Vector<const uint8_t> bundle, size_t index);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -4,7 +4,12 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +17,67 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// Snapshots are compressed in independent blocks so that they can be
+// decompressed in parallel. The compressed data consists of uint32_t-sized
+// entries:
+//   uncompressed size, block count, compressed size per block,
+// followed by the raw deflate streams of the blocks. All blocks but the last
+// one decompress to exactly kBlockSize bytes.
+constexpr uint32_t kBlockSize = 256 * KB;
+
+uint32_t ReadUint32(const Bytef* data, size_t index) {
+  uint32_t value;
+  MemCopy(&value, data + index * sizeof(value), sizeof(value));
+  return value;
 }
 
+void WriteUint32(Bytef* data, size_t index, uint32_t value) {
+  MemCopy(data + index * sizeof(value), &value, sizeof(value));
+}
+
+struct DecompressionBlock {
+  const Bytef* input;
+  uLong input_size;
+  Bytef* output;
+  uLongf output_size;
+};
+
+void DecompressBlock(const DecompressionBlock& block) {
+  uLongf uncompressed_size = block.output_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(zlib_internal::ZRAW, block.output,
+                                           &uncompressed_size, block.input,
+                                           block.input_size),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, block.output_size);
+}
+
+class DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(base::Vector<const DecompressionBlock> blocks)
+      : blocks_(blocks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      const size_t index = next_block_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= blocks_.size()) return;
+      DecompressBlock(blocks_[index]);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next_block = next_block_.load(std::memory_order_relaxed);
+    return next_block >= blocks_.size() ? 0 : blocks_.size() - next_block;
+  }
+
+ private:
+  const base::Vector<const DecompressionBlock> blocks_;
+  std::atomic<size_t> next_block_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +85,45 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  const uint32_t payload_length = static_cast<uint32_t>(input.size());
+  const uint32_t block_count =
+      std::max<uint32_t>(1, (payload_length + kBlockSize - 1) / kBlockSize);
+  const size_t header_size = (2 + block_count) * sizeof(uint32_t);
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
-
-  uint8_t* compressed_data =
-      const_cast<uint8_t*>(snapshot_data.RawData().begin());
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  size_t max_size = header_size;
+  for (uint32_t i = 0; i < block_count; i++) {
+    max_size += compressBound(
+        std::min(kBlockSize, payload_length - i * kBlockSize));
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_size));
+
+  Bytef* compressed_data = const_cast<Bytef*>(snapshot_data.RawData().begin());
+  WriteUint32(compressed_data, 0, payload_length);
+  WriteUint32(compressed_data, 1, block_count);
+  size_t compressed_size = header_size;
+  for (uint32_t i = 0; i < block_count; i++) {
+    const uint32_t offset = i * kBlockSize;
+    const uLongf input_size = std::min(kBlockSize, payload_length - offset);
+    uLongf block_size = compressBound(input_size);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &block_size,
+                 reinterpret_cast<const Bytef*>(input.begin() + offset),
+                 input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUint32(compressed_data, 2 + i, static_cast<uint32_t>(block_size));
+    compressed_size += block_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(static_cast<uint32_t>(compressed_size));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %u bytes in %u blocks took %0.3f ms]\n",
+           payload_length, block_count, ms);
   }
   return snapshot_data;
 }
@@ -71,27 +136,41 @@ SnapshotData SnapshotCompression::Decompress(
 
   const Bytef* input_bytef =
       reinterpret_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const uint32_t uncompressed_payload_length = ReadUint32(input_bytef, 0);
+  const uint32_t block_count = ReadUint32(input_bytef, 1);
+  const size_t header_size = (2 + block_count) * sizeof(uint32_t);
+  CHECK_LE(header_size, compressed_data.size());
 
   snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  Bytef* output = const_cast<Bytef*>(snapshot_data.RawData().begin());
+
+  std::vector<DecompressionBlock> blocks(block_count);
+  size_t input_offset = header_size;
+  for (uint32_t i = 0; i < block_count; i++) {
+    const uint32_t output_offset = i * kBlockSize;
+    DecompressionBlock& block = blocks[i];
+    block.input = input_bytef + input_offset;
+    block.input_size = ReadUint32(input_bytef, 2 + i);
+    block.output = output + output_offset;
+    block.output_size =
+        std::min(kBlockSize, uncompressed_payload_length - output_offset);
+    input_offset += block.input_size;
+  }
+  CHECK_EQ(input_offset, compressed_data.size());
+
+  if (v8_flags.parallel_snapshot_decompression && block_count > 1) {
+    std::unique_ptr<JobHandle> job = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking,
+        std::make_unique<DecompressionJob>(base::VectorOf(blocks)));
+    job->Join();
+  } else {
+    for (const DecompressionBlock& block : blocks) DecompressBlock(block);
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %u bytes in %u blocks took %0.3f ms]\n",
+           uncompressed_payload_length, block_count, ms);
   }
   return snapshot_data;
 }
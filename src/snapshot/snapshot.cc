@@ -208,6 +208,26 @@ MaybeDirectHandle<Context> Snapshot::NewContextFromSnapshot(
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   bool can_rehash = ExtractRehashability(blob);
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (v8_flags.cache_decompressed_context_snapshots) {
+    base::Vector<const uint8_t> decompressed =
+        isolate->decompressed_context_snapshot(context_index);
+    if (decompressed.empty()) {
+      SnapshotData snapshot_data(
+          MaybeDecompress(isolate, SnapshotImpl::ExtractContextData(
+                                       blob, static_cast<uint32_t>(
+                                                 context_index))));
+      isolate->set_decompressed_context_snapshot(
+          context_index, base::OwnedCopyOf(snapshot_data.RawData()));
+      decompressed = isolate->decompressed_context_snapshot(context_index);
+    }
+    SnapshotData snapshot_data(decompressed);
+    return ContextDeserializer::DeserializeContext(
+        isolate, &snapshot_data, context_index, can_rehash, global_proxy,
+        embedder_fields_deserializer);
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
   base::Vector<const uint8_t> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
@@ -52,9 +52,9 @@ void BuiltinsSorter::InitializeClusters() {
     Builtin id = Builtins::FromInt(i);
     Builtins::Kind kind = Builtins::KindOf(id);
     if (kind == Builtins::Kind::ASM || kind == Builtins::Kind::CPP) {
-      // CHECK there is no data for execution count for non TurboFan compiled
-      // builtin.
-      CHECK_EQ(builtin_density_map_[id], 0);
+      // Non TurboFan compiled builtins are not reordered. Basic block profiles
+      // have no execution count for them, but sampled profiles (see
+      // tools/builtins-pgo/perf_to_profile.py) may.
       continue;
     }
     Cluster* cls =
@@ -264,8 +264,16 @@ void BuiltinsSorter::ProcessBuiltinDensityLineInfo(
   int density = static_cast<int>(strtol(token.c_str(), &end, 0));
   CHECK(errno == 0 && end != token.c_str());
 
-  Builtin builtin_id = name2id[builtin_name];
-  builtin_density_map_.emplace(builtin_id, density);
+  auto it = name2id.find(builtin_name);
+  if (it == name2id.end()) {
+    // Sampled profiles may have been recorded with a different set of
+    // builtins. Always warn, since a profile whose names don't match any
+    // builtin would otherwise silently leave the order unchanged.
+    PrintF(stderr, "Warning: Ignoring profile data for unknown builtin %s\n",
+           builtin_name.c_str());
+    return;
+  }
+  builtin_density_map_.emplace(it->second, density);
 }
 
 void BuiltinsSorter::InitializeCallGraph(const char* profiling_file,
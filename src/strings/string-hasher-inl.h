@@ -43,9 +43,29 @@ uint32_t ConvertRawHashToUsableHash(T raw_hash) {
 }
 
 V8_INLINE bool IsOnly8Bit(const uint16_t* chars, unsigned len) {
-  // TODO(leszeks): This could be SIMD for efficiency on large strings, if we
-  // need it.
-  for (unsigned i = 0; i < len; ++i) {
+  unsigned i = 0;
+  // Check 8 characters at a time, by testing whether any of their high bytes
+  // is set.
+#ifdef __SSE2__
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= len; i += 8) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    __m128i high_bytes = _mm_srli_epi16(x, 8);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bytes, zero)) != 0xffff) {
+      return false;
+    }
+  }
+#elif defined(__ARM_NEON__)
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t x;
+    memcpy(&x, chars + i, sizeof(x));
+    uint8x8_t high_bytes = vshrn_n_u16(x, 8);
+    if (vget_lane_u64(vreinterpret_u64_u8(high_bytes), 0) != 0) {
+      return false;
+    }
+  }
+#endif
+  for (; i < len; ++i) {
     if (chars[i] > 255) {
       return false;
     }
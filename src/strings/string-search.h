@@ -5,11 +5,18 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include <limits>
+
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -264,6 +271,69 @@ inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
   return true;
 }
 
+#ifdef __SSE2__
+// Compares a block of subject characters against both the first and the last
+// pattern character at once, and only compares the characters in between at
+// positions where both match. Returns the first match or -1 and advances
+// |index| to the first position that was not checked.
+template <typename PatternChar, typename SubjectChar>
+inline int FirstAndLastCharacterSearch(base::Vector<const PatternChar> pattern,
+                                       base::Vector<const SubjectChar> subject,
+                                       int* index) {
+  static_assert(sizeof(SubjectChar) == 1 || sizeof(SubjectChar) == 2);
+  constexpr int kCharsPerBlock = sizeof(__m128i) / sizeof(SubjectChar);
+  // Each matching character sets this many bits in the movemask.
+  constexpr uint32_t kLaneMask = sizeof(SubjectChar) == 1 ? 0x1 : 0x3;
+  auto splat = [](PatternChar c) {
+    // Patterns that do not fit the subject's characters were rejected when
+    // choosing the search strategy.
+    DCHECK_LE(c, std::numeric_limits<SubjectChar>::max());
+    if constexpr (sizeof(SubjectChar) == 1) {
+      return _mm_set1_epi8(static_cast<char>(c));
+    } else {
+      return _mm_set1_epi16(static_cast<int16_t>(c));
+    }
+  };
+  auto compare = [](__m128i a, __m128i b) {
+    if constexpr (sizeof(SubjectChar) == 1) {
+      return _mm_cmpeq_epi8(a, b);
+    } else {
+      return _mm_cmpeq_epi16(a, b);
+    }
+  };
+
+  const int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  const int last_offset = pattern_length - 1;
+  const __m128i first = splat(pattern[0]);
+  const __m128i last = splat(pattern[last_offset]);
+  const SubjectChar* const chars = subject.begin();
+  const int limit = subject.length() - last_offset - kCharsPerBlock;
+  int i = *index;
+  for (; i <= limit; i += kCharsPerBlock) {
+    const __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    const __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(chars + i + last_offset));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+        compare(block_first, first), compare(block_last, last))));
+    while (mask != 0) {
+      const int bit = base::bits::CountTrailingZeros(mask);
+      const int candidate = i + bit / static_cast<int>(sizeof(SubjectChar));
+      if (pattern_length == 2 ||
+          CharCompare(pattern.begin() + 1, chars + candidate + 1,
+                      pattern_length - 2)) {
+        *index = candidate;
+        return candidate;
+      }
+      mask &= ~(kLaneMask << bit);
+    }
+  }
+  *index = i;
+  return -1;
+}
+#endif  // __SSE2__
+
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -273,6 +343,9 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
   int i = index;
+#ifdef __SSE2__
+  if (FirstAndLastCharacterSearch(pattern, subject, &i) != -1) return i;
+#endif  // __SSE2__
   int n = subject.length() - pattern_length;
   while (i <= n) {
     i = FindFirstCharacter(pattern, subject, i);
@@ -4,6 +4,8 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -180,6 +182,64 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
   }
 }
 
+void Utf8StreamDecoder::Append(base::Vector<const uint8_t> data) {
+  const uint8_t* cursor = data.begin();
+  const uint8_t* end = data.end();
+  while (cursor < end) {
+    if (state_ == unibrow::Utf8::State::kAccept) {
+      // Copy runs of ASCII characters in bulk.
+      uint32_t remaining =
+          static_cast<uint32_t>(std::min<size_t>(end - cursor, kMaxUInt32));
+      uint32_t ascii_length = NonAsciiStart(cursor, remaining);
+      if (is_one_byte_) {
+        one_byte_.insert(one_byte_.end(), cursor, cursor + ascii_length);
+      } else {
+        two_byte_.insert(two_byte_.end(), cursor, cursor + ascii_length);
+      }
+      cursor += ascii_length;
+      if (cursor == end) break;
+    }
+    unibrow::uchar c =
+        unibrow::Utf8::ValueOfIncremental(&cursor, &state_, &incomplete_);
+    if (c != unibrow::Utf8::kIncomplete) AddCharacter(c);
+  }
+}
+
+void Utf8StreamDecoder::Finish() {
+  unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&state_);
+  incomplete_ = 0;
+  if (c != unibrow::Utf8::kBufferEmpty) AddCharacter(c);
+}
+
+void Utf8StreamDecoder::Reset() {
+  state_ = unibrow::Utf8::State::kAccept;
+  incomplete_ = 0;
+  is_one_byte_ = true;
+  one_byte_.clear();
+  two_byte_.clear();
+}
+
+void Utf8StreamDecoder::AddCharacter(unibrow::uchar c) {
+  if (is_one_byte_) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      one_byte_.push_back(static_cast<uint8_t>(c));
+      return;
+    }
+    // Widen the output decoded so far.
+    two_byte_.reserve(one_byte_.size() + 1);
+    two_byte_.assign(one_byte_.begin(), one_byte_.end());
+    one_byte_.clear();
+    one_byte_.shrink_to_fit();
+    is_one_byte_ = false;
+  }
+  if (c <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    two_byte_.push_back(static_cast<uint16_t>(c));
+  } else {
+    two_byte_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    two_byte_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  }
+}
+
 #define DEFINE_UNICODE_DECODER(Decoder)                                 \
   template V8_EXPORT_PRIVATE Utf8DecoderBase<Decoder>::Utf8DecoderBase( \
       base::Vector<const uint8_t> data);                                \
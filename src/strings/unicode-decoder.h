@@ -5,6 +5,8 @@
 #ifndef V8_STRINGS_UNICODE_DECODER_H_
 #define V8_STRINGS_UNICODE_DECODER_H_
 
+#include <vector>
+
 #include "src/base/vector.h"
 #include "src/strings/unicode.h"
 
@@ -91,6 +93,49 @@ class V8_EXPORT_PRIVATE Utf8Decoder final
   }
 };
 
+// Decodes UTF-8 input that arrives in chunks, which may split multi-byte
+// sequences at arbitrary positions. The decoded result is identical to the one
+// Utf8Decoder produces for the concatenated input. Characters are accumulated
+// as one-byte data until the first character that does not fit into a single
+// byte is seen, after which the output is widened to two-byte data.
+class V8_EXPORT_PRIVATE Utf8StreamDecoder final {
+ public:
+  Utf8StreamDecoder() = default;
+  Utf8StreamDecoder(const Utf8StreamDecoder&) = delete;
+  Utf8StreamDecoder& operator=(const Utf8StreamDecoder&) = delete;
+
+  void Append(base::Vector<const uint8_t> data);
+
+  // Terminates the input, replacing an incomplete trailing sequence with
+  // U+FFFD. Afterwards the decoded data can be retrieved.
+  void Finish();
+
+  // Discards all input and output.
+  void Reset();
+
+  bool is_one_byte() const { return is_one_byte_; }
+  size_t length() const {
+    return is_one_byte_ ? one_byte_.size() : two_byte_.size();
+  }
+  base::Vector<const uint8_t> one_byte_data() const {
+    DCHECK(is_one_byte_);
+    return base::VectorOf(one_byte_);
+  }
+  base::Vector<const uint16_t> two_byte_data() const {
+    DCHECK(!is_one_byte_);
+    return base::VectorOf(two_byte_);
+  }
+
+ private:
+  void AddCharacter(unibrow::uchar c);
+
+  unibrow::Utf8::State state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_ = 0;
+  bool is_one_byte_ = true;
+  std::vector<uint8_t> one_byte_;
+  std::vector<uint16_t> two_byte_;
+};
+
 #if V8_ENABLE_WEBASSEMBLY
 // Like Utf8Decoder above, except that instead of replacing invalid sequences
 // with U+FFFD, we have a separate Encoding::kInvalid state, and we also accept
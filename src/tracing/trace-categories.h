@@ -42,6 +42,7 @@ PERFETTO_DEFINE_CATEGORIES_IN_NAMESPACE_WITH_ATTRS(
     perfetto::Category(TRACE_DISABLED_BY_DEFAULT("v8.compile")).SetTags("slow"),
     perfetto::Category(TRACE_DISABLED_BY_DEFAULT("v8.cpu_profiler"))
         .SetTags("slow"),
+    perfetto::Category(TRACE_DISABLED_BY_DEFAULT("v8.deopt")).SetTags("slow"),
     perfetto::Category(TRACE_DISABLED_BY_DEFAULT("v8.gc")).SetTags("slow"),
     perfetto::Category(TRACE_DISABLED_BY_DEFAULT("v8.gc_stats"))
         .SetTags("slow"),
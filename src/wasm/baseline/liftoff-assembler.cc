@@ -12,6 +12,7 @@
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/wasm-compiler.h"
+#include "src/utils/bit-vector.h"
 #include "src/utils/ostreams.h"
 #include "src/wasm/baseline/liftoff-assembler-inl.h"
 #include "src/wasm/baseline/liftoff-register.h"
@@ -652,6 +653,19 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsAssignedInLoop(const BitVector& assigned) {
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState* local_slot = &cache_state_.stack_state[i];
+    // Constants are spilled as well, since the merge at the back edge cannot
+    // materialize a constant in the target state.
+    if (local_slot->is_reg() && !assigned.Contains(i) &&
+        cache_state_.get_use_count(local_slot->reg()) == 1) {
+      continue;
+    }
+    Spill(local_slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (VarState& slot : cache_state_.stack_state) {
     if (!slot.is_reg()) continue;
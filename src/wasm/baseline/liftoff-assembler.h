@@ -570,6 +570,9 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Like {SpillLocals}, but keeps locals which are not in {assigned} in their
+  // register if that register is not shared with any other stack slot.
+  void SpillLocalsAssignedInLoop(const BitVector& assigned);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
@@ -1596,10 +1596,19 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // into registers at branches. Locals which are not assigned within the
+    // loop can stay in their register though, as the back edge will not have
+    // to move them.
+    BitVector* assigned = nullptr;
+    if (v8_flags.liftoff_keep_loop_invariant_locals && !for_debugging_) {
+      assigned = WasmDecoder<ValidationTag>::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), __ num_locals(), decoder->zone());
+    }
+    if (assigned) {
+      __ SpillLocalsAssignedInLoop(*assigned);
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -7446,10 +7455,55 @@ class LiftoffCompiler {
     return VarState{kRef, reg, 0};
   }
 
+  bool CanAllocateInline(bool is_shared, int size) {
+    return v8_flags.inline_new && v8_flags.liftoff_inline_allocation &&
+           !is_shared && kSystemPointerSize == kInt64Size &&
+           size <= kMaxRegularHeapObjectSize;
+  }
+
+  // Allocates {size} bytes in the young generation by bumping the top of the
+  // linear allocation area, and initializes the map and properties of the new
+  // object. Jumps to {slow_path} (with {rtt} intact) if the allocation area is
+  // exhausted. All cache registers must be spilled already.
+  void AllocateInline(LiftoffRegister result, LiftoffRegister rtt, int size,
+                      Label* slow_path) {
+    SCOPED_CODE_COMMENT("inline allocation");
+    LiftoffRegList pinned{result, rtt};
+    Register top = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    Register new_top = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    Register limit = pinned.set(__ GetUnusedRegister(kGpReg, pinned)).gp();
+    const int top_offset = static_cast<int>(
+        IsolateData::GetOffset(IsolateFieldId::kNewAllocationInfoTop));
+    const int limit_offset = static_cast<int>(
+        IsolateData::GetOffset(IsolateFieldId::kNewAllocationInfoLimit));
+    __ LoadFullPointer(top, kRootRegister, top_offset);
+    __ LoadFullPointer(limit, kRootRegister, limit_offset);
+    __ emit_ptrsize_addi(new_top, top, size);
+    FREEZE_STATE(all_spilled_anyway);
+    __ emit_cond_jump(kUnsignedGreaterThanEqual, slow_path, kIntPtrKind,
+                      new_top, limit, all_spilled_anyway);
+    __ Store(kRootRegister, no_reg, top_offset, LiftoffRegister(new_top),
+             StoreType::kI64Store, pinned);
+
+    // Initialize the header. The object is not tagged yet, and being freshly
+    // allocated in new-space, it does not need write barriers.
+    __ StoreTaggedPointer(top, no_reg, HeapObject::kMapOffset, rtt.gp(),
+                          pinned, nullptr, LiftoffAssembler::kSkipWriteBarrier);
+    Register empty_fixed_array = limit;
+    __ LoadFullPointer(
+        empty_fixed_array, kRootRegister,
+        IsolateData::root_slot_offset(RootIndex::kEmptyFixedArray));
+    __ StoreTaggedPointer(top, no_reg, JSReceiver::kPropertiesOrHashOffset,
+                          empty_fixed_array, pinned, nullptr,
+                          LiftoffAssembler::kSkipWriteBarrier);
+    __ emit_ptrsize_addi(result.gp(), top, kHeapObjectTag);
+  }
+
   void StructNew(FullDecoder* decoder, const StructIndexImmediate& imm,
                  const Value& descriptor, bool initial_values_on_stack) {
     const TypeDefinition& type = decoder->module_->type(imm.index);
     LiftoffRegister rtt = GetRtt(decoder, imm.index, type, descriptor);
+    const int size = WasmStruct::Size(imm.struct_type);
 
     if (type.is_descriptor()) {
       VarState first_field = GetFirstFieldIfPrototype(
@@ -7460,13 +7514,24 @@ class LiftoffCompiler {
                    VarState{kI32, static_cast<int32_t>(imm.index.index), 0},
                    first_field},
                   decoder->position());
+    } else if (CanAllocateInline(type.is_shared, size)) {
+      // The builtin call on the slow path would spill all registers anyway.
+      __ SpillAllRegisters();
+      Label slow_path, done;
+      AllocateInline(LiftoffRegister(kReturnRegister0), rtt, size, &slow_path);
+      __ emit_jump(&done);
+      __ bind(&slow_path);
+      CallBuiltin(Builtin::kWasmAllocateStructWithRtt,
+                  MakeSig::Returns(kRef).Params(kRef, kI32),
+                  {VarState{kRef, rtt, 0}, VarState{kI32, size, 0}},
+                  decoder->position());
+      __ bind(&done);
     } else {
       bool is_shared = type.is_shared;
       CallBuiltin(is_shared ? Builtin::kWasmAllocateSharedStructWithRtt
                             : Builtin::kWasmAllocateStructWithRtt,
                   MakeSig::Returns(kRef).Params(kRef, kI32),
-                  {VarState{kRef, rtt, 0},
-                   VarState{kI32, WasmStruct::Size(imm.struct_type), 0}},
+                  {VarState{kRef, rtt, 0}, VarState{kI32, size, 0}},
                   decoder->position());
     }
 
@@ -7873,12 +7938,32 @@ class LiftoffCompiler {
     int32_t elem_count = length_imm.index;
     // Allocate the array.
     const bool is_shared = decoder->module_->type(array_imm.index).is_shared;
+    const int size =
+        WasmArray::kHeaderSize +
+        RoundUp(elem_count * value_kind_size(elem_kind), kTaggedSize);
+    Label done;
+    if (CanAllocateInline(is_shared, size)) {
+      // The builtin call on the slow path would spill all registers anyway.
+      __ SpillAllRegisters();
+      Label slow_path;
+      LiftoffRegister array(kReturnRegister0);
+      AllocateInline(array, rtt, size, &slow_path);
+      LiftoffRegister length =
+          __ GetUnusedRegister(kGpReg, LiftoffRegList{array});
+      __ LoadConstant(length, WasmValue(elem_count));
+      __ Store(array.gp(), no_reg,
+               wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset), length,
+               StoreType::kI32Store, LiftoffRegList{array});
+      __ emit_jump(&done);
+      __ bind(&slow_path);
+    }
     CallBuiltin(is_shared ? Builtin::kWasmAllocateSharedArray_Uninitialized
                           : Builtin::kWasmAllocateArray_Uninitialized,
                 MakeSig::Returns(kRef).Params(kRef, kI32, kI32),
                 {VarState{kRef, rtt, 0}, VarState{kI32, elem_count, 0},
                  VarState{kI32, value_kind_size(elem_kind), 0}},
                 decoder->position());
+    __ bind(&done);
 
     // Initialize the array with stack arguments.
     LiftoffRegister array(kReturnRegister0);
@@ -8215,11 +8300,12 @@ class LiftoffCompiler {
     //     - any case not listed above.
     // Cases (2) and (3) can share most of their implementation.
     const TypeDefinition& type = module->type(target_type.ref_index());
+    bool is_final = type.is_effectively_final();
     bool compare_map =
-        (!type.has_descriptor() && (type.is_final || target_type.is_exact())) ||
+        (!type.has_descriptor() && (is_final || target_type.is_exact())) ||
         rtt_is_custom_descriptor;
     bool compare_last_super =
-        type.has_descriptor() && (type.is_final || target_type.is_exact());
+        type.has_descriptor() && (is_final || target_type.is_exact());
 
     if (compare_map) {
       __ emit_cond_jump(kNotEqual, no_match, ValueKind::kRef, tmp1, rtt_reg,
@@ -2813,11 +2813,12 @@ void WasmInterpreterRuntime::Trace(const char* format, ...) {
 #endif  // V8_ENABLE_DRUMBRAKE_TRACING
 
 // static
-ModuleWireBytes InterpreterHandle::GetBytes(Tagged<Tuple2> interpreter_object) {
+std::shared_ptr<base::OwnedVector<const uint8_t>> InterpreterHandle::GetBytes(
+    Tagged<Tuple2> interpreter_object) {
   Tagged<WasmInstanceObject> wasm_instance =
       WasmInterpreterObject::get_wasm_instance(interpreter_object);
   NativeModule* native_module = wasm_instance->module_object()->native_module();
-  return ModuleWireBytes{native_module->wire_bytes()};
+  return native_module->shared_wire_bytes();
 }
 
 InterpreterHandle::InterpreterHandle(Isolate* isolate,
@@ -630,12 +630,12 @@ void InitInstructionTableOnce(Isolate* isolate) {
 
 WasmInterpreter::WasmInterpreter(
     Isolate* isolate, const WasmModule* module,
-    const ModuleWireBytes& wire_bytes,
+    std::shared_ptr<base::OwnedVector<const uint8_t>> wire_bytes,
     DirectHandle<WasmInstanceObject> instance_object)
     : zone_(isolate->allocator(), ZONE_NAME),
       instance_object_(MakeWeak(isolate, instance_object)),
-      module_bytes_(wire_bytes.start(), wire_bytes.end(), &zone_),
-      codemap_(isolate, module, module_bytes_.data(), &zone_) {
+      module_bytes_(std::move(wire_bytes)),
+      codemap_(isolate, module, module_bytes_->begin(), &zone_) {
   wasm_runtime_ = std::make_shared<WasmInterpreterRuntime>(
       module, isolate, instance_object_, &codemap_);
   module->SetWasmInterpreter(wasm_runtime_);
@@ -626,7 +626,7 @@ class V8_EXPORT_PRIVATE WasmInterpreter {
   };
 
   WasmInterpreter(Isolate* isolate, const WasmModule* module,
-                  const ModuleWireBytes& wire_bytes,
+                  std::shared_ptr<base::OwnedVector<const uint8_t>> wire_bytes,
                   DirectHandle<WasmInstanceObject> instance);
 
   static void InitializeOncePerProcess();
@@ -660,15 +660,16 @@ class V8_EXPORT_PRIVATE WasmInterpreter {
  private:
   // This {Zone} has the lifespan of this {WasmInterpreter}, which should
   // have the lifespan of the corresponding {WasmInstanceObject}.
-  // The zone is used to allocate the {module_bytes_} vector below and the
-  // {InterpreterCode} vector in the {CodeMap}. It is also passed to
-  // {WasmDecoder} used to parse the 'locals' in a Wasm function.
+  // The zone is used to allocate the {InterpreterCode} vector in the
+  // {CodeMap}. It is also passed to {WasmDecoder} used to parse the 'locals'
+  // in a Wasm function.
   Zone zone_;
   IndirectHandle<WasmInstanceObject> instance_object_;
 
-  // Create a copy of the module bytes for the interpreter, since the passed
-  // pointer might be invalidated after constructing the interpreter.
-  const ZoneVector<uint8_t> module_bytes_;
+  // Keep the module bytes of the {NativeModule} alive instead of copying them
+  // for each instance, since the {NativeModule} might replace its wire bytes
+  // after constructing the interpreter.
+  const std::shared_ptr<base::OwnedVector<const uint8_t>> module_bytes_;
 
   CodeMap codemap_;
 
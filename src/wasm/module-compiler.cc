@@ -2230,7 +2230,8 @@ WasmError ValidateFunctions(const WasmModule* module,
                             base::Vector<const uint8_t> wire_bytes,
                             WasmEnabledFeatures enabled_features,
                             OnlyLazyFunctions only_lazy_functions,
-                            WasmDetectedFeatures* detected_features) {
+                            WasmDetectedFeatures* detected_features,
+                            TaskPriority priority) {
   DCHECK_EQ(module->origin, kWasmOrigin);
   if (only_lazy_functions && !IsLazyModule(module)) {
     return {};
@@ -2245,16 +2246,17 @@ WasmError ValidateFunctions(const WasmModule* module,
   }
   // Call {ValidateFunctions} in the module decoder.
   return ValidateFunctions(module, enabled_features, wire_bytes, filter,
-                           detected_features);
+                           detected_features, priority);
 }
 
 WasmError ValidateFunctions(const NativeModule& native_module,
-                            OnlyLazyFunctions only_lazy_functions) {
+                            OnlyLazyFunctions only_lazy_functions,
+                            TaskPriority priority) {
   WasmDetectedFeatures detected_features;
   WasmError result =
       ValidateFunctions(native_module.module(), native_module.wire_bytes(),
                         native_module.enabled_features(), only_lazy_functions,
-                        &detected_features);
+                        &detected_features, priority);
   if (!result.has_error()) {
     // This function is called before the NativeModule is finished; all detected
     // features will be published afterwards anyway, so ignore the return value
@@ -2291,8 +2293,10 @@ void CompileNativeModule(Isolate* isolate,
   // will catch this during lazy compilation).
   if (!v8_flags.wasm_lazy_validation && module->origin == kWasmOrigin) {
     DCHECK(!thrower->error());
-    if (WasmError validation_error =
-            ValidateFunctions(*native_module, kOnlyLazyFunctions)) {
+    // Synchronous compilation blocks the caller until all functions are
+    // validated, so request all available workers.
+    if (WasmError validation_error = ValidateFunctions(
+            *native_module, kOnlyLazyFunctions, TaskPriority::kUserBlocking)) {
       thrower->CompileFailed(std::move(validation_error));
       return;
     }
@@ -2304,8 +2308,8 @@ void CompileNativeModule(Isolate* isolate,
 
   if (compilation_state->failed()) {
     DCHECK_IMPLIES(IsLazyModule(module), !v8_flags.wasm_lazy_validation);
-    WasmError validation_error =
-        ValidateFunctions(*native_module, kAllFunctions);
+    WasmError validation_error = ValidateFunctions(
+        *native_module, kAllFunctions, TaskPriority::kUserBlocking);
     CHECK(validation_error.has_error());
     thrower->CompileFailed(std::move(validation_error));
   }
@@ -3059,7 +3063,8 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
         const WasmModule* module = result.value().get();
         if (WasmError validation_error = ValidateFunctions(
                 module, job->wire_bytes_.module_bytes(), job->enabled_features_,
-                kOnlyLazyFunctions, &job->detected_features_)) {
+                kOnlyLazyFunctions, &job->detected_features_,
+                TaskPriority::kUserVisible)) {
           result = ModuleResult{std::move(validation_error)};
         }
       }
@@ -3129,7 +3134,8 @@ class AsyncCompileJob::PrepareAndStartCompile : public CompileStep {
       // will be validated during eager compilation.
       DCHECK(start_compilation_);
       if (!v8_flags.wasm_lazy_validation &&
-          ValidateFunctions(*job->native_module_, kOnlyLazyFunctions)
+          ValidateFunctions(*job->native_module_, kOnlyLazyFunctions,
+                            TaskPriority::kUserVisible)
               .has_error()) {
         // Fail compilation, invalidating the {AsyncCompileJob}.
         std::move(*job).Failed();
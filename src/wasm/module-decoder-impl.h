@@ -9,6 +9,8 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <algorithm>
+
 #include "src/base/platform/wrappers.h"
 #include "src/strings/unicode.h"
 #include "src/utils/ostreams.h"
@@ -792,6 +794,26 @@ class ModuleDecoderImpl : public Decoder {
         tracer_->NextLine();
       }
     }
+    if (ok()) MarkTypesWithSubtypes();
+  }
+
+  // Sets {has_subtypes} for all types that are extended by another type. As
+  // types of different recgroups can be canonically equivalent, this is
+  // tracked per canonical type.
+  void MarkTypesWithSubtypes() {
+    WasmModule* module = module_.get();
+    std::vector<uint32_t> extended;
+    for (const TypeDefinition& type_def : module->types) {
+      if (!type_def.supertype.valid()) continue;
+      extended.push_back(module->canonical_type_id(type_def.supertype).index);
+    }
+    if (extended.empty()) return;
+    std::sort(extended.begin(), extended.end());
+    for (uint32_t i = 0; i < module->types.size(); ++i) {
+      uint32_t canonical = module->canonical_type_id(ModuleTypeIndex{i}).index;
+      module->types[i].has_subtypes =
+          std::binary_search(extended.begin(), extended.end(), canonical);
+    }
   }
 
   void FinalizeRecgroup(uint32_t group_size, TypeCanonicalizer* type_canon) {
@@ -623,7 +623,8 @@ WasmError ValidateFunctions(const WasmModule* module,
                             WasmEnabledFeatures enabled_features,
                             base::Vector<const uint8_t> wire_bytes,
                             std::function<bool(int)> filter,
-                            WasmDetectedFeatures* detected_features_out) {
+                            WasmDetectedFeatures* detected_features_out,
+                            TaskPriority priority) {
   TRACE_EVENT2(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.ValidateFunctions", "num_declared_functions",
                module->num_declared_functions, "has_filter", filter != nullptr);
@@ -654,7 +655,7 @@ WasmError ValidateFunctions(const WasmModule* module,
   } else {
     // Spawn the task and join it.
     std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
-        TaskPriority::kUserVisible, std::move(validate_job));
+        priority, std::move(validate_job));
     job_handle->Join();
   }
 
@@ -11,6 +11,7 @@
 
 #include <memory>
 
+#include "include/v8-platform.h"
 #include "src/common/globals.h"
 #include "src/logging/metrics.h"
 #include "src/wasm/function-body-decoder.h"
@@ -153,10 +154,13 @@ void DecodeCanonicalTypeNames(
 // (deterministically), or an empty {WasmError} if all validated functions are
 // valid. {filter} determines which functions are validated. Pass an empty
 // function for "all functions". The {filter} callback needs to be thread-safe.
+// The validation job is posted at {priority}; callers that block the embedder
+// (e.g. synchronous compilation) should pass {TaskPriority::kUserBlocking}.
 V8_EXPORT_PRIVATE WasmError ValidateFunctions(
     const WasmModule*, WasmEnabledFeatures enabled_features,
     base::Vector<const uint8_t> wire_bytes, std::function<bool(int)> filter,
-    WasmDetectedFeatures* detected_features);
+    WasmDetectedFeatures* detected_features,
+    TaskPriority priority = TaskPriority::kUserVisible);
 
 WasmError GetWasmErrorWithName(base::Vector<const uint8_t> wire_bytes,
                                int func_index, const WasmModule* module,
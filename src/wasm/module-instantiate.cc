@@ -4,6 +4,8 @@
 
 #include "src/wasm/module-instantiate.h"
 
+#include <atomic>
+
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
 #include "src/base/atomicops.h"
@@ -405,6 +407,12 @@ WellKnownImport CheckForWellKnownImport(
         COMPARE_MATH_BUILTIN_F64(Log)
         COMPARE_MATH_BUILTIN_F64(Pow)
         COMPARE_MATH_BUILTIN_F64(Sqrt)
+        COMPARE_MATH_BUILTIN_F64(Abs)
+        COMPARE_MATH_BUILTIN_F64(Ceil)
+        COMPARE_MATH_BUILTIN_F64(Floor)
+        COMPARE_MATH_BUILTIN_F64(Trunc)
+        COMPARE_MATH_BUILTIN_F64(Min)
+        COMPARE_MATH_BUILTIN_F64(Max)
 
 #undef COMPARE_MATH_BUILTIN_F64
 
@@ -2052,6 +2060,58 @@ bool MaybeMarkError(ValueOrError value, ErrorThrower* thrower) {
   }
   return false;
 }
+
+// Copies a large data segment into memory in chunks on all available workers.
+class CopyDataSegmentJob final : public JobTask {
+ public:
+  static constexpr size_t kChunkSize = 1 * MB;
+  // Smaller segments are copied on the main thread directly, as the overhead
+  // of posting a job would outweigh the benefit.
+  static constexpr size_t kMinSizeForParallelCopy = 8 * kChunkSize;
+
+  CopyDataSegmentJob(uint8_t* dst, const uint8_t* src, size_t size)
+      : dst_(dst),
+        src_(src),
+        size_(size),
+        num_chunks_((size + kChunkSize - 1) / kChunkSize) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks_) return;
+      size_t offset = chunk * kChunkSize;
+      std::memcpy(dst_ + offset, src_ + offset,
+                  std::min(kChunkSize, size_ - offset));
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk >= num_chunks_ ? 0 : num_chunks_ - next_chunk;
+  }
+
+ private:
+  uint8_t* const dst_;
+  const uint8_t* const src_;
+  const size_t size_;
+  const size_t num_chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+void CopyDataSegment(uint8_t* dst, const uint8_t* src, size_t size) {
+  if (size < CopyDataSegmentJob::kMinSizeForParallelCopy ||
+      v8_flags.single_threaded) {
+    std::memcpy(dst, src, size);
+    return;
+  }
+  // Segments are still copied one after the other, so overlapping segments
+  // keep their spec-mandated order. Instantiation blocks on the copy, so use
+  // the highest priority and let the main thread participate.
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
+      TaskPriority::kUserBlocking,
+      std::make_unique<CopyDataSegmentJob>(dst, src, size));
+  job_handle->Join();
+}
 }  // namespace
 
 // Look up an import value in the {ffi_} object specifically for linking an
@@ -2142,8 +2202,8 @@ void InstanceBuilder::LoadDataSegments() {
     }
 
     uint8_t* memory_base = trusted_data_->memory_base(segment.memory_index);
-    std::memcpy(memory_base + dest_offset,
-                wire_bytes_.begin() + segment.source.offset(), size);
+    CopyDataSegment(memory_base + dest_offset,
+                    wire_bytes_.begin() + segment.source.offset(), size);
   }
 }
 
@@ -4,6 +4,8 @@
 
 #include "src/wasm/pgo.h"
 
+#include <algorithm>
+
 #include "src/wasm/decoder.h"
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
@@ -102,61 +104,112 @@ class ProfileGenerator {
   const std::atomic<uint32_t>* const tiering_budget_array_;
 };
 
-void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
-  base::MutexGuard mutex_guard{&module->type_feedback.mutex};
-  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
-      module->type_feedback.feedback_for_function;
+// Profile data is not trusted: it may be stale or belong to a different module
+// with the same hash. All indexes are therefore validated, and nothing is
+// applied to the module unless all of the data could be decoded.
+bool DeserializeTypeFeedback(
+    Decoder& decoder, const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>>* result) {
+  const uint32_t num_functions = module->num_imported_functions +
+                                 module->num_declared_functions;
   uint32_t num_entries = decoder.consume_u32v("num function entries");
-  CHECK_LE(num_entries, module->num_declared_functions);
-  for (uint32_t missing_entries = num_entries; missing_entries > 0;
-       --missing_entries) {
+  if (num_entries > module->num_declared_functions) {
+    decoder.error("too many function entries");
+    return false;
+  }
+  result->reserve(num_entries);
+  for (uint32_t missing_entries = num_entries;
+       missing_entries > 0 && decoder.ok(); --missing_entries) {
     FunctionTypeFeedback function_feedback;
     uint32_t function_index = decoder.consume_u32v("function index");
-    // Deserialize {feedback_vector}.
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      decoder.error("invalid function index");
+      return false;
+    }
+    // Deserialize {feedback_vector}. Each entry takes at least one byte.
     uint32_t feedback_vector_size =
         decoder.consume_u32v("feedback vector size");
+    if (feedback_vector_size > decoder.available_bytes()) {
+      decoder.error("feedback vector size out of bounds");
+      return false;
+    }
     function_feedback.feedback_vector =
         base::OwnedVector<CallSiteFeedback>::NewForOverwrite(
             feedback_vector_size);
     for (CallSiteFeedback& feedback : function_feedback.feedback_vector) {
       int num_cases = decoder.consume_i32v("num cases");
+      if (num_cases < 0 || num_cases > kMaxPolymorphism) {
+        decoder.error("invalid number of cases");
+        return false;
+      }
       if (num_cases == 0) continue;  // no feedback
-      if (num_cases == 1) {          // monomorphic
-        int called_function_index = decoder.consume_i32v("function index");
-        int call_count = decoder.consume_i32v("call count");
-        feedback = CallSiteFeedback{called_function_index, call_count};
+      CallSiteFeedback::PolymorphicCase cases[kMaxPolymorphism];
+      for (int i = 0; i < num_cases; ++i) {
+        cases[i].function_index = decoder.consume_i32v("function index");
+        cases[i].absolute_call_frequency = decoder.consume_i32v("call count");
+        if (static_cast<uint32_t>(cases[i].function_index) >= num_functions) {
+          decoder.error("invalid called function index");
+          return false;
+        }
+      }
+      if (num_cases == 1) {  // monomorphic
+        feedback = CallSiteFeedback{cases[0].function_index,
+                                    cases[0].absolute_call_frequency};
       } else {  // polymorphic
         auto* polymorphic = new CallSiteFeedback::PolymorphicCase[num_cases];
-        for (int i = 0; i < num_cases; ++i) {
-          polymorphic[i].function_index =
-              decoder.consume_i32v("function index");
-          polymorphic[i].absolute_call_frequency =
-              decoder.consume_i32v("call count");
-        }
+        std::copy_n(cases, num_cases, polymorphic);
         feedback = CallSiteFeedback{polymorphic, num_cases};
       }
     }
     // Deserialize {call_targets}.
     uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (num_call_targets > decoder.available_bytes()) {
+      decoder.error("number of call targets out of bounds");
+      return false;
+    }
     function_feedback.call_targets =
         base::OwnedVector<uint32_t>::NewForOverwrite(num_call_targets);
     for (uint32_t& call_target : function_feedback.call_targets) {
       call_target = decoder.consume_u32v("call target");
+      if (call_target >= num_functions &&
+          call_target != FunctionTypeFeedback::kCallRef &&
+          call_target != FunctionTypeFeedback::kCallIndirect) {
+        decoder.error("invalid call target");
+        return false;
+      }
     }
+    result->emplace_back(function_index, std::move(function_feedback));
+  }
+  return decoder.ok();
+}
 
-    // Finally, insert the new feedback into the map. Overwrite existing
-    // feedback, but check for consistency.
-    auto [feedback_it, is_new] = feedback_for_function.emplace(
-        function_index, std::move(function_feedback));
-    if (!is_new) {
-      FunctionTypeFeedback& old_feedback = feedback_it->second;
-      CHECK(old_feedback.feedback_vector.empty() ||
-            old_feedback.feedback_vector.size() == feedback_vector_size);
-      CHECK_EQ(old_feedback.call_targets.as_vector(),
-               function_feedback.call_targets.as_vector());
-      std::swap(old_feedback.feedback_vector,
-                function_feedback.feedback_vector);
+void ApplyTypeFeedback(
+    const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>> decoded_feedback) {
+  base::MutexGuard mutex_guard{&module->type_feedback.mutex};
+  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  for (auto& [function_index, function_feedback] : decoded_feedback) {
+    // Insert the new feedback into the map. Overwrite existing feedback if it
+    // is consistent with the profile, otherwise keep the existing feedback.
+    size_t feedback_vector_size = function_feedback.feedback_vector.size();
+    auto [feedback_it, is_new] =
+        feedback_for_function.emplace(function_index, FunctionTypeFeedback{});
+    FunctionTypeFeedback& old_feedback = feedback_it->second;
+    if (is_new) {
+      old_feedback = std::move(function_feedback);
+      continue;
+    }
+    if (!old_feedback.feedback_vector.empty() &&
+        old_feedback.feedback_vector.size() != feedback_vector_size) {
+      continue;
     }
+    if (old_feedback.call_targets.as_vector() !=
+        function_feedback.call_targets.as_vector()) {
+      continue;
+    }
+    std::swap(old_feedback.feedback_vector, function_feedback.feedback_vector);
   }
 }
 
@@ -168,7 +221,10 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
     uint8_t tiering_info = decoder.consume_u8("tiering info");
-    CHECK_EQ(0, tiering_info & ~3);
+    if (tiering_info & ~(kFunctionExecutedBit | kFunctionTieredUpBit)) {
+      decoder.error("invalid tiering info");
+    }
+    if (decoder.failed()) return {};
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
     if (was_tiered_up) tiered_up_functions.push_back(func_index);
@@ -179,17 +235,24 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
                                               std::move(tiered_up_functions));
 }
 
+base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, std::atomic<uint32_t>* tiering_budget_array) {
+  ProfileGenerator profile_generator{module, tiering_budget_array};
+  return profile_generator.GetProfileData();
+}
+
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
+    const WasmModule* module, base::Vector<const uint8_t> profile_data) {
   Decoder decoder{profile_data.begin(), profile_data.end()};
 
-  DeserializeTypeFeedback(decoder, module);
+  std::vector<std::pair<uint32_t, FunctionTypeFeedback>> decoded_feedback;
+  if (!DeserializeTypeFeedback(decoder, module, &decoded_feedback)) return {};
   std::unique_ptr<ProfileInformation> pgo_info =
       DeserializeTieringInformation(decoder, module);
+  if (!pgo_info) return {};
+  if (decoder.pc() != decoder.end()) return {};
 
-  CHECK(decoder.ok());
-  CHECK_EQ(decoder.pc(), decoder.end());
-
+  ApplyTypeFeedback(module, std::move(decoded_feedback));
   return pgo_info;
 }
 
@@ -204,8 +267,8 @@ void DumpProfileToFile(const WasmModule* module,
   base::EmbeddedVector<char, 32> filename;
   SNPrintF(filename, "profile-wasm-%08x", hash);
 
-  ProfileGenerator profile_generator{module, tiering_budget_array};
-  base::OwnedVector<uint8_t> profile_data = profile_generator.GetProfileData();
+  base::OwnedVector<uint8_t> profile_data =
+      GetProfileData(module, tiering_budget_array);
 
   PrintF(
       "Dumping Wasm PGO data to file '%s' (module size %zu, %u declared "
@@ -250,7 +313,13 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
 
   base::Fclose(file);
 
-  return RestoreProfileData(module, profile_data.as_vector());
+  std::unique_ptr<ProfileInformation> pgo_info =
+      RestoreProfileData(module, profile_data.as_vector());
+  if (!pgo_info) {
+    PrintF("Ignoring invalid Wasm PGO data from file '%s'\n",
+           filename.begin());
+  }
+  return pgo_info;
 }
 
 }  // namespace v8::internal::wasm
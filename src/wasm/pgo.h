@@ -40,6 +40,18 @@ class ProfileInformation {
   const std::vector<uint32_t> tiered_up_functions_;
 };
 
+// Returns the serialized profile (type feedback and tiering information) of
+// the given module.
+V8_EXPORT_PRIVATE base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, std::atomic<uint32_t>* tiering_budget_array);
+
+// Applies the type feedback in {profile_data} to {module} and returns the
+// tiering information. Returns nullptr without modifying {module} if the data
+// is malformed or does not match the module.
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+RestoreProfileData(const WasmModule* module,
+                   base::Vector<const uint8_t> profile_data);
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array);
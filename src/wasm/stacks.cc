@@ -197,7 +197,7 @@ bool StackMemory::IsValidContinuation(Tagged<WasmContinuationObject> cont) {
 }
 
 std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
-  while (size_ > kMaxSize) {
+  while (size_ > MaxSize()) {
     size_ -= freelist_.back()->allocated_size();
     freelist_.pop_back();
   }
@@ -217,7 +217,7 @@ std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
 }
 
 void StackPool::Add(std::unique_ptr<StackMemory> stack) {
-  // Add the stack to the pool regardless of kMaxSize, because the stack might
+  // Add the stack to the pool regardless of MaxSize(), because the stack might
   // still be in use by the unwinder.
   // Shrink the freelist lazily when we get the next stack instead.
   size_ += stack->allocated_size();
@@ -253,11 +253,12 @@ class StackPool {
   size_t Size() const;
 
  private:
+  // The maximum total size of the stacks in the free list, see
+  // {v8_flags.wasm_stack_pool_size}.
+  static size_t MaxSize() { return v8_flags.wasm_stack_pool_size * KB; }
+
   std::vector<std::unique_ptr<StackMemory>> freelist_;
   size_t size_ = 0;
-  // If the next finished stack would move the total size above this limit, the
-  // stack is freed instead of being added to the free list.
-  static constexpr int kMaxSize = 4 * MB;
 };
 
 }  // namespace v8::internal::wasm
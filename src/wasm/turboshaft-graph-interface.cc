@@ -2449,6 +2449,24 @@ class TurboshaftGraphBuildingInterface
       case WKI::kMathF64Sqrt:
         result = __ Float64Sqrt(args[0].op);
         break;
+      case WKI::kMathF64Abs:
+        result = UnOpImpl(kExprF64Abs, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathF64Ceil:
+        result = UnOpImpl(kExprF64Ceil, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathF64Floor:
+        result = UnOpImpl(kExprF64Floor, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathF64Trunc:
+        result = UnOpImpl(kExprF64Trunc, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathF64Min:
+        result = BinOpImpl(kExprF64Min, args[0].op, args[1].op);
+        break;
+      case WKI::kMathF64Max:
+        result = BinOpImpl(kExprF64Max, args[0].op, args[1].op);
+        break;
 
         // Fast API calls.
       case WKI::kFastAPICall: {
@@ -5135,14 +5153,14 @@ class TurboshaftGraphBuildingInterface
 
   SubtypeCheckExactness GetExactness(FullDecoder* decoder, HeapType target) {
     // For exact target types, an exact match is needed for correctness;
-    // for final target types, it's a performance optimization.
+    // for (effectively) final target types, it's a performance optimization.
     // For types with custom descriptors, we need to look at their immediate
     // supertype instead of the object's map.
     // See Liftoff's {SubtypeCheck()} for detailed explanation. This function
     // here is not called for instructions using custom descriptors
     // (ref.cast_desc, br_on_cast_desc{,_fail}).
     const TypeDefinition& type = decoder->module_->type(target.ref_index());
-    if (type.is_final || target.is_exact()) {
+    if (type.is_effectively_final() || target.is_exact()) {
       return type.has_descriptor()
                  ? SubtypeCheckExactness::kExactMatchLastSupertype
                  : SubtypeCheckExactness::kExactMatchOnly;
@@ -7483,6 +7501,33 @@ class TurboshaftGraphBuildingInterface
     }
   }
 
+  // Returns an upper bound (inclusive) for the value of the memory64 {index},
+  // derived from the operation producing it.
+  uint64_t Memory64IndexUpperBound(V<Word64> index) {
+    if (!index.valid()) return kMaxUInt64;
+    OperationMatcher matcher(__ output_graph());
+    uint64_t constant;
+    if (matcher.MatchIntegralWord64Constant(index, &constant)) return constant;
+    V<Word64> input;
+    if (matcher.MatchBitwiseAndWithConstant(index, &input, &constant,
+                                            WordRepresentation::Word64())) {
+      return constant;
+    }
+    int amount;
+    if (matcher.MatchConstantShift(index, &input,
+                                   ShiftOp::Kind::kShiftRightLogical,
+                                   WordRepresentation::Word64(), &amount)) {
+      return kMaxUInt64 >> amount;
+    }
+    if (const ChangeOp* change =
+            __ output_graph().Get(index).template TryCast<ChangeOp>();
+        change && change->kind == ChangeOp::Kind::kZeroExtend &&
+        change->from == RegisterRepresentation::Word32()) {
+      return kMaxUInt32;
+    }
+    return kMaxUInt64;
+  }
+
   std::pair<V<WordPtr>, compiler::BoundsCheckResult> BoundsCheckMem(
       const wasm::WasmMemory* memory, MemoryRepresentation repr, OpIndex index,
       uintptr_t offset, compiler::EnforceBoundsCheck enforce_bounds_check,
@@ -7565,11 +7610,15 @@ class TurboshaftGraphBuildingInterface
         // Bounds check `index` against `kMaxMemory64Size - end_offset`, such
         // that at runtime `index + end_offset` will be within
         // `kMaxMemory64Size`, where the trap handler can handle out-of-bound
-        // accesses.
-        V<Word32> cond = __ Uint64LessThan(
-            V<Word64>::Cast(converted_index),
-            __ Word64Constant(uint64_t{wasm::kMaxMemory64Size - end_offset}));
-        __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
+        // accesses. The check can be skipped if the index is known to be
+        // small enough already.
+        uint64_t limit = uint64_t{wasm::kMaxMemory64Size - end_offset};
+        V<Word64> index64 = V<Word64>::Cast(converted_index);
+        if (Memory64IndexUpperBound(index64) >= limit) {
+          V<Word32> cond =
+              __ Uint64LessThan(index64, __ Word64Constant(limit));
+          __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
+        }
       }
       return {converted_index, compiler::BoundsCheckResult::kTrapHandler};
     }
@@ -760,6 +760,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   base::Vector<const uint8_t> wire_bytes() const {
     return std::atomic_load(&wire_bytes_)->as_vector();
   }
+  std::shared_ptr<base::OwnedVector<const uint8_t>> shared_wire_bytes() const {
+    return std::atomic_load(&wire_bytes_);
+  }
   const WasmModule* module() const { return module_.get(); }
   std::shared_ptr<const WasmModule> shared_module() const { return module_; }
   size_t committed_code_space() const {
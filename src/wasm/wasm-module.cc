@@ -24,6 +24,11 @@
 
 namespace v8::internal::wasm {
 
+bool TypeDefinition::is_effectively_final() const {
+  return is_final ||
+         (v8_flags.experimental_wasm_closed_world && !has_subtypes);
+}
+
 void UpdateComputedInformation(WasmMemory* memory, ModuleOrigin origin) {
   const uintptr_t platform_max_pages =
       memory->is_memory64() ? wasm::max_mem64_pages() : wasm::max_mem32_pages();
@@ -446,6 +446,10 @@ struct TypeDefinition {
 
   bool has_descriptor() const { return descriptor.valid(); }
   bool is_descriptor() const { return describes.valid(); }
+  // Whether objects of this type are known not to be of a subtype: the type
+  // is final, or no type in the module extends it and the module is assumed
+  // to be closed-world.
+  bool is_effectively_final() const;
 
   union {
     const FunctionSig* function_sig = nullptr;
@@ -459,6 +463,8 @@ struct TypeDefinition {
   Kind kind = kFunction;
   bool is_final = false;
   bool is_shared = false;
+  // Whether any type of the module declares this type as its supertype.
+  bool has_subtypes = false;
   uint8_t subtyping_depth = 0;
 };
 
@@ -83,6 +83,18 @@ const char* WellKnownImportName(WellKnownImport wki) {
       return "Math.pow";
     case WellKnownImport::kMathF64Sqrt:
       return "Math.sqrt";
+    case WellKnownImport::kMathF64Abs:
+      return "Math.abs";
+    case WellKnownImport::kMathF64Ceil:
+      return "Math.ceil";
+    case WellKnownImport::kMathF64Floor:
+      return "Math.floor";
+    case WellKnownImport::kMathF64Trunc:
+      return "Math.trunc";
+    case WellKnownImport::kMathF64Min:
+      return "Math.min";
+    case WellKnownImport::kMathF64Max:
+      return "Math.max";
 
       // String-related functions:
     case WellKnownImport::kDoubleToString:
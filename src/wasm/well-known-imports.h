@@ -91,6 +91,14 @@ enum class WellKnownImport : uint8_t {
   kMathF64Log,
   kMathF64Pow,
   kMathF64Sqrt,  // Used by dart2wasm. f64.sqrt is equivalent.
+  // The following have equivalent Wasm instructions when imported with a
+  // numeric signature.
+  kMathF64Abs,
+  kMathF64Ceil,
+  kMathF64Floor,
+  kMathF64Trunc,
+  kMathF64Min,
+  kMathF64Max,
 
   // String-related functions:
   kDoubleToString,
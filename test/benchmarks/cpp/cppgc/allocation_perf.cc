@@ -50,6 +50,70 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+template <size_t Size>
+class SizedObject final : public GarbageCollected<SizedObject<Size>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[Size];
+};
+
+// Cycles through sizes that are served by different normal page spaces.
+BENCHMARK_F(Allocate, MixedSizes)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  size_t bytes = 0;
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<16>>(
+        heap().GetAllocationHandle()));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<48>>(
+        heap().GetAllocationHandle()));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<112>>(
+        heap().GetAllocationHandle()));
+    benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<240>>(
+        heap().GetAllocationHandle()));
+    bytes += sizeof(SizedObject<16>) + sizeof(SizedObject<48>) +
+             sizeof(SizedObject<112>) + sizeof(SizedObject<240>);
+  }
+  st.SetBytesProcessed(bytes);
+}
+
+// A cppgc heap may only be used from the thread that created it. Concurrent
+// allocation thus happens on one heap per thread and measures contention on
+// process-wide state such as the page allocator.
+class AllocateMultiThreaded : public testing::BenchmarkWithHeap {
+ public:
+  void SetUp(::benchmark::State&) override {}
+  void TearDown(::benchmark::State&) override {}
+};
+
+template <typename T>
+void AllocateOnThreadLocalHeap(benchmark::State& st) {
+  auto heap = cppgc::Heap::Create(testing::BenchmarkWithHeap::GetPlatform());
+  {
+    subtle::NoGarbageCollectionScope no_gc(*Heap::From(heap.get()));
+    for (auto _ : st) {
+      USE(_);
+      T* result = cppgc::MakeGarbageCollected<T>(heap->GetAllocationHandle());
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(T));
+}
+
+BENCHMARK_DEFINE_F(AllocateMultiThreaded, Tiny)(benchmark::State& st) {
+  AllocateOnThreadLocalHeap<TinyObject>(st);
+}
+BENCHMARK_REGISTER_F(AllocateMultiThreaded, Tiny)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(AllocateMultiThreaded, Large)(benchmark::State& st) {
+  AllocateOnThreadLocalHeap<LargeObject>(st);
+}
+BENCHMARK_REGISTER_F(AllocateMultiThreaded, Large)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
@@ -27,11 +27,11 @@ class BenchmarkWithHeap : public benchmark::Fixture {
 
   cppgc::Heap& heap() const { return *heap_.get(); }
 
- private:
   static std::shared_ptr<testing::TestPlatform> GetPlatform() {
     return platform_;
   }
 
+ private:
   static std::shared_ptr<testing::TestPlatform> platform_;
 
   std::unique_ptr<cppgc::Heap> heap_;
@@ -0,0 +1,76 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/objects/fixed-array-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace i = v8::internal;
+
+namespace {
+
+class HeapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+  i::Heap* heap() { return i_isolate()->heap(); }
+
+  // Allocates `count` small arrays reachable from the returned root array, so
+  // the collector has to trace and copy or mark all of them.
+  i::Handle<i::FixedArray> AllocateGraph(int count,
+                                         i::AllocationType allocation) {
+    i::Factory* factory = i_isolate()->factory();
+    i::Handle<i::FixedArray> root = factory->NewFixedArray(count, allocation);
+    for (int k = 0; k < count; k++) {
+      i::DirectHandle<i::FixedArray> leaf =
+          factory->NewFixedArray(4, allocation);
+      leaf->set(0, i::Smi::FromInt(k));
+      root->set(k, *leaf);
+    }
+    return root;
+  }
+};
+
+}  // namespace
+
+// Measures a scavenge over a freshly allocated, fully live young generation.
+BENCHMARK_DEFINE_F(HeapBenchmark, Scavenge)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    v8::HandleScope handle_scope(v8_isolate());
+    i::Handle<i::FixedArray> root =
+        AllocateGraph(count, i::AllocationType::kYoung);
+    st.ResumeTiming();
+    heap()->CollectGarbage(i::NEW_SPACE,
+                           i::GarbageCollectionReason::kTesting);
+    benchmark::DoNotOptimize(root);
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, Scavenge)->Arg(1000)->Arg(50000);
+
+// Measures a full mark-compact over a retained old-generation graph.
+BENCHMARK_DEFINE_F(HeapBenchmark, MarkCompact)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  v8::HandleScope handle_scope(v8_isolate());
+  i::Handle<i::FixedArray> root = AllocateGraph(count, i::AllocationType::kOld);
+  for (auto _ : st) {
+    USE(_);
+    heap()->CollectAllGarbage(i::GCFlag::kNoFlags,
+                              i::GarbageCollectionReason::kTesting);
+  }
+  benchmark::DoNotOptimize(root);
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, MarkCompact)->Arg(1000)->Arg(50000);
@@ -0,0 +1,133 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Local<v8::String> v8_str(const char* x) {
+  return v8::String::NewFromUtf8(v8::Isolate::GetCurrent(), x).ToLocalChecked();
+}
+
+// Builds an array of records mixing short strings, integers, doubles and
+// nested objects, which is representative of API payloads.
+std::string MakeJsonInput(int records) {
+  std::string json = "[";
+  for (int i = 0; i < records; i++) {
+    if (i > 0) json += ",";
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"item" +
+            std::to_string(i) + "\",\"price\":" + std::to_string(i) +
+            ".25,\"tags\":[\"a\",\"b\",\"c\"],\"active\":true,"
+            "\"meta\":{\"created\":\"2026-01-01T00:00:00Z\",\"score\":0.5}}";
+  }
+  json += "]";
+  return json;
+}
+
+class JsonBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  class NullSink final : public v8::JSON::OutputSink {
+   public:
+    void Write(const char* data, size_t length) override {
+      benchmark::DoNotOptimize(data);
+      bytes_ += length;
+    }
+
+    size_t bytes() const { return bytes_; }
+
+   private:
+    size_t bytes_ = 0;
+  };
+
+  void SetUp(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    const std::string input = MakeJsonInput(static_cast<int>(state.range(0)));
+    input_size_ = input.size();
+    v8::Local<v8::String> input_string = v8_str(input.c_str());
+    input_.Reset(isolate, input_string);
+    value_.Reset(isolate,
+                 v8::JSON::Parse(context, input_string).ToLocalChecked());
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    value_.Reset();
+    input_.Reset();
+    auto context = context_.Get(isolate);
+    context->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  v8::Global<v8::Context> context_;
+  v8::Global<v8::String> input_;
+  v8::Global<v8::Value> value_;
+  size_t input_size_ = 0;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(JsonBenchmark, Parse)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::String> input = input_.Get(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        v8::JSON::Parse(context, input).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetBytesProcessed(st.iterations() * input_size_);
+}
+BENCHMARK_REGISTER_F(JsonBenchmark, Parse)->Arg(10)->Arg(1000);
+
+BENCHMARK_DEFINE_F(JsonBenchmark, Stringify)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> value = value_.Get(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::String> result =
+        v8::JSON::Stringify(context, value).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetBytesProcessed(st.iterations() * input_size_);
+}
+BENCHMARK_REGISTER_F(JsonBenchmark, Stringify)->Arg(10)->Arg(1000);
+
+BENCHMARK_DEFINE_F(JsonBenchmark, StringifyToUtf8)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> value = value_.Get(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    NullSink sink;
+    bool serialized =
+        v8::JSON::StringifyToUtf8(context, value, &sink).FromJust();
+    benchmark::DoNotOptimize(serialized);
+  }
+  st.SetBytesProcessed(st.iterations() * input_size_);
+}
+BENCHMARK_REGISTER_F(JsonBenchmark, StringifyToUtf8)->Arg(10)->Arg(1000);
@@ -0,0 +1,67 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/objects/ordered-hash-table.h"
+#include "src/objects/smi.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace i = v8::internal;
+
+namespace {
+
+class OrderedHashMapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+
+  // Builds a map holding the Smi keys [0, count), growing it from the
+  // minimum capacity so that rehashing is part of the measured work.
+  i::Handle<i::OrderedHashMap> BuildMap(int count) {
+    i::Isolate* isolate = i_isolate();
+    i::Handle<i::OrderedHashMap> map =
+        i::OrderedHashMap::Allocate(isolate,
+                                    i::OrderedHashMap::kInitialCapacity)
+            .ToHandleChecked();
+    for (int k = 0; k < count; k++) {
+      i::Handle<i::Smi> key(i::Smi::FromInt(k), isolate);
+      map = i::OrderedHashMap::Add(isolate, map, key, key).ToHandleChecked();
+    }
+    return map;
+  }
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(OrderedHashMapBenchmark, Add)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    benchmark::DoNotOptimize(BuildMap(count));
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(OrderedHashMapBenchmark, Add)->Arg(16)->Arg(4096);
+
+BENCHMARK_DEFINE_F(OrderedHashMapBenchmark, FindEntry)(benchmark::State& st) {
+  const int count = static_cast<int>(st.range(0));
+  v8::HandleScope handle_scope(v8_isolate());
+  i::Handle<i::OrderedHashMap> map = BuildMap(count);
+  for (auto _ : st) {
+    USE(_);
+    for (int k = 0; k < count; k++) {
+      benchmark::DoNotOptimize(
+          map->FindEntry(i_isolate(), i::Smi::FromInt(k)));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(OrderedHashMapBenchmark, FindEntry)->Arg(16)->Arg(4096);
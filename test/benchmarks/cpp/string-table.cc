@@ -0,0 +1,74 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+class StringTableBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    const int count = static_cast<int>(state.range(0));
+    keys_.clear();
+    keys_.reserve(count);
+    for (int i = 0; i < count; i++) {
+      keys_.push_back("property_" + std::to_string(i));
+    }
+    v8::HandleScope handle_scope(v8_isolate());
+    for (const std::string& key : keys_) {
+      i_isolate()->factory()->InternalizeUtf8String(key.c_str());
+    }
+  }
+
+  void TearDown(::benchmark::State& state) override { keys_.clear(); }
+
+ protected:
+  v8::internal::Isolate* i_isolate() {
+    return reinterpret_cast<v8::internal::Isolate*>(v8_isolate());
+  }
+
+  std::vector<std::string> keys_;
+};
+
+}  // namespace
+
+// Every key is already in the table, so this measures hashing and probing.
+BENCHMARK_DEFINE_F(StringTableBenchmark, LookupHit)(benchmark::State& st) {
+  v8::internal::Factory* factory = i_isolate()->factory();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    for (const std::string& key : keys_) {
+      benchmark::DoNotOptimize(factory->InternalizeUtf8String(key.c_str()));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * keys_.size());
+}
+BENCHMARK_REGISTER_F(StringTableBenchmark, LookupHit)->Arg(100)->Arg(10000);
+
+// Every key is new, so each call also allocates and inserts an entry.
+BENCHMARK_DEFINE_F(StringTableBenchmark, Insert)(benchmark::State& st) {
+  v8::internal::Factory* factory = i_isolate()->factory();
+  int next = 0;
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    for (size_t i = 0; i < keys_.size(); i++) {
+      const std::string key = "fresh_" + std::to_string(next++);
+      benchmark::DoNotOptimize(factory->InternalizeUtf8String(key.c_str()));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * keys_.size());
+}
+BENCHMARK_REGISTER_F(StringTableBenchmark, Insert)->Arg(100)->Arg(10000);
@@ -0,0 +1,110 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <utility>
+
+#include "include/v8-context.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-value-serializer.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Local<v8::String> v8_str(const char* x) {
+  return v8::String::NewFromUtf8(v8::Isolate::GetCurrent(), x).ToLocalChecked();
+}
+
+// Mirrors a typical postMessage payload: an array of plain objects holding
+// strings, numbers, a Map and a typed array.
+const char* kMakeValue =
+    "(function() {"
+    "  const result = [];"
+    "  for (let i = 0; i < 1000; i++) {"
+    "    result.push({id: i, name: 'item' + i, price: i + 0.25,"
+    "                 tags: ['a', 'b', 'c'], data: new Uint8Array(16),"
+    "                 lookup: new Map([[i, 'v' + i]])});"
+    "  }"
+    "  return result;"
+    "})()";
+
+class ValueSerializerBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_str(kMakeValue)).ToLocalChecked();
+    v8::Local<v8::Value> value = script->Run(context).ToLocalChecked();
+    value_.Reset(isolate, value);
+
+    v8::ValueSerializer serializer(isolate);
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context, value).FromJust());
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    data_ = buffer.first;
+    size_ = buffer.second;
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    free(data_);
+    data_ = nullptr;
+    value_.Reset();
+    auto context = context_.Get(isolate);
+    context->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  v8::Global<v8::Context> context_;
+  v8::Global<v8::Value> value_;
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
+BENCHMARK_F(ValueSerializerBenchmark, Serialize)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> value = value_.Get(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ValueSerializer serializer(v8_isolate());
+    serializer.WriteHeader();
+    bool written = serializer.WriteValue(context, value).FromJust();
+    benchmark::DoNotOptimize(written);
+    free(serializer.Release().first);
+  }
+  st.SetBytesProcessed(st.iterations() * size_);
+}
+
+BENCHMARK_F(ValueSerializerBenchmark, Deserialize)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ValueDeserializer deserializer(v8_isolate(), data_, size_);
+    CHECK(deserializer.ReadHeader(context).FromJust());
+    v8::Local<v8::Value> result =
+        deserializer.ReadValue(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetBytesProcessed(st.iterations() * size_);
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdint>
+
+#include "src/base/macros.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+struct Node {
+  Node* next;
+  intptr_t value;
+};
+
+}  // namespace
+
+// Allocates many small objects, which is the common pattern in the parser and
+// compilers, and then releases the whole zone at once.
+static void BM_ZoneNewSmallObjects(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  v8::internal::AccountingAllocator allocator;
+  for (auto _ : state) {
+    USE(_);
+    v8::internal::Zone zone(&allocator, "ZoneBenchmark");
+    Node* head = nullptr;
+    for (int i = 0; i < count; i++) {
+      head = zone.New<Node>(Node{head, i});
+    }
+    benchmark::DoNotOptimize(head);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ZoneNewSmallObjects)->Arg(100)->Arg(100000);
+
+static void BM_ZoneAllocateArrays(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  v8::internal::AccountingAllocator allocator;
+  for (auto _ : state) {
+    USE(_);
+    v8::internal::Zone zone(&allocator, "ZoneBenchmark");
+    for (int i = 0; i < count; i++) {
+      benchmark::DoNotOptimize(zone.AllocateArray<intptr_t>(i % 64 + 1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ZoneAllocateArrays)->Arg(100)->Arg(100000);
@@ -13,6 +13,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -431,6 +432,74 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+HEAP_TEST(CompactionPauseBudgetLimitsEvacuation) {
+  if (!v8_flags.compact || v8_flags.stress_compaction ||
+      v8_flags.stress_compaction_random || v8_flags.compact_on_every_full_gc ||
+      v8_flags.optimize_for_size) {
+    return;
+  }
+  // Test that --compaction-pause-budget-ms caps the bytes evacuated by a
+  // single full GC, so fragmented pages are only partially compacted.
+  ManualGCScope manual_gc_scope;
+  FLAG_VALUE_SCOPE(compaction_pause_budget_ms, 1);
+
+  const int kPages = 10;
+  const int kObjectsPerPage = 10;
+  const int kLiveObjectsPerPage = 2;
+  const int object_size = GetObjectSize(kObjectsPerPage);
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    // Fragment old space: each page keeps only a fifth of its objects alive.
+    IndirectHandle<FixedArray> live = isolate->factory()->NewFixedArray(
+        kPages * kLiveObjectsPerPage, AllocationType::kOld);
+    for (int page = 0; page < kPages; page++) {
+      HandleScope scope2(isolate);
+      CHECK(heap->old_space()->TryExpand(heap->main_thread_local_heap(),
+                                         AllocationOrigin::kRuntime));
+      DirectHandleVector<FixedArray> page_handles(isolate);
+      heap::CreatePadding(
+          heap,
+          static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+          AllocationType::kOld, &page_handles, object_size);
+      for (int i = 0; i < kLiveObjectsPerPage; i++) {
+        live->set(page * kLiveObjectsPerPage + i, *page_handles[i]);
+      }
+    }
+    std::vector<Address> addresses;
+    for (int i = 0; i < live->length(); i++) {
+      addresses.push_back(live->get(i).ptr());
+    }
+
+    // Let the traced compaction speed be one page area per millisecond, so the
+    // budget allows evacuating the live objects of about half of the pages.
+    const size_t area_size = heap->old_space()->AreaSize();
+    for (int i = 0; i < 32; i++) {
+      heap->tracer()->AddCompactionEvent(1.0, area_size);
+    }
+
+    heap::InvokeMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+
+    size_t evacuated_bytes = 0;
+    for (int i = 0; i < live->length(); i++) {
+      if (live->get(i).ptr() != addresses[i]) {
+        evacuated_bytes += Cast<HeapObject>(live->get(i))->Size();
+      }
+    }
+    // Without the budget, all pages would have been evacuated.
+    CHECK_LT(0u, evacuated_bytes);
+    CHECK_LE(evacuated_bytes, area_size);
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -85,6 +85,7 @@
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/test-transitions.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -1155,6 +1156,69 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnMemoryPressure) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.flush_code_on_memory_pressure = true;
+
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    IndirectHandle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    IndirectHandle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(IsJSFunction(*func_value));
+    IndirectHandle<JSFunction> function = Cast<JSFunction>(func_value);
+    CHECK(function->shared()->is_compiled());
+
+    // Regular GCs only age the function.
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(function->shared()->is_compiled());
+
+    // A critical memory pressure GC flushes it even though it is still young.
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
+    }
+    heap->MemoryPressureNotification(MemoryPressureLevel::kNone, true);
+    CHECK(!function->shared()->is_compiled());
+    CHECK(!function->is_compiled(i_isolate));
+
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
@@ -5389,6 +5453,59 @@ HEAP_TEST(NumberStringCacheSize) {
            heap->double_string_cache()->capacity());
 }
 
+TEST(NumberStringCacheGrowthKeepsEntries) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  if (isolate->MemorySaverModeEnabled()) return;
+
+  // Convert a number, then a second one that maps to the same entry of the
+  // initial cache. The collision grows the cache, and the first number must
+  // still be cached afterwards.
+  if (factory->smi_string_cache()->capacity() ==
+      SmiStringCache::kInitialSize) {
+    Tagged<Smi> first = Smi::FromInt(1000);
+    Tagged<Smi> second = Smi::FromInt(1000 + SmiStringCache::kInitialSize);
+    DirectHandle<String> first_string = factory->SmiToString(first);
+    if (factory->smi_string_cache()->capacity() ==
+        SmiStringCache::kInitialSize) {
+      CHECK_EQ(factory->smi_string_cache()->GetEntryFor(first),
+               factory->smi_string_cache()->GetEntryFor(second));
+      USE(factory->SmiToString(second));
+      CHECK_LT(SmiStringCache::kInitialSize,
+               factory->smi_string_cache()->capacity());
+      DirectHandle<Object> cached = SmiStringCache::Get(
+          isolate, SmiStringCache::GetEntryFor(isolate, first), first);
+      CHECK_EQ(*first_string, *cached);
+    }
+  }
+
+  if (factory->double_string_cache()->capacity() ==
+      DoubleStringCache::kInitialSize) {
+    double first = 1000.5;
+    uint64_t first_bits = base::bit_cast<uint64_t>(first);
+    DirectHandle<String> first_string = factory->DoubleToString(first);
+    if (factory->double_string_cache()->capacity() ==
+        DoubleStringCache::kInitialSize) {
+      InternalIndex entry =
+          factory->double_string_cache()->GetEntryFor(first_bits);
+      double second = first + 1;
+      while (factory->double_string_cache()->GetEntryFor(
+                 base::bit_cast<uint64_t>(second)) != entry) {
+        second += 1;
+      }
+      USE(factory->DoubleToString(second));
+      CHECK_LT(DoubleStringCache::kInitialSize,
+               factory->double_string_cache()->capacity());
+      DirectHandle<Object> cached = DoubleStringCache::Get(
+          isolate, DoubleStringCache::GetEntryFor(isolate, first_bits),
+          first_bits);
+      CHECK_EQ(*first_string, *cached);
+    }
+  }
+}
+
 TEST(Regress3877) {
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
@@ -7659,6 +7776,34 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+UNINITIALIZED_TEST(MemoryBalancerProcessMemoryBudget) {
+  FlagScope<bool> memory_balancer_scope(&v8_flags.memory_balancer, true);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  // A budget below the live memory leaves no room above the minimum limit.
+  v8::V8::SetProcessMemoryBudget(1);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(i_isolate);
+    HandleScope scope(i_isolate);
+    std::vector<Handle<FixedArray>> arrays;
+    for (int i = 0; i < 20; i++) {
+      arrays.push_back(i_isolate->factory()->NewFixedArray(10000));
+    }
+    heap::InvokeMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+    CHECK_LE(heap->old_generation_allocation_limit(),
+             std::max(heap->min_old_generation_size(),
+                      heap->OldGenerationSizeOfObjects() + 2 * MB));
+  }
+  v8::V8::SetProcessMemoryBudget(0);
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
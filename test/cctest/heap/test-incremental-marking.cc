@@ -35,7 +35,8 @@ namespace heap {
 
 class MockPlatform : public TestPlatform {
  public:
-  MockPlatform() : taskrunner_(new MockTaskRunner()) {}
+  explicit MockPlatform(bool idle_tasks_enabled = false)
+      : taskrunner_(new MockTaskRunner(idle_tasks_enabled)) {}
   ~MockPlatform() override {
     for (auto& task : worker_tasks_) {
       CcTest::default_platform()->PostTaskOnWorkerThread(
@@ -55,15 +56,26 @@ class MockPlatform : public TestPlatform {
     worker_tasks_.push_back(std::move(task));
   }
 
-  bool IdleTasksEnabled(v8::Isolate* isolate) override { return false; }
+  bool IdleTasksEnabled(v8::Isolate* isolate) override {
+    return taskrunner_->IdleTasksEnabled();
+  }
 
   bool PendingTask() { return taskrunner_->PendingTask(); }
 
   void PerformTask() { taskrunner_->PerformTask(); }
 
+  bool PendingIdleTask() { return taskrunner_->PendingIdleTask(); }
+
+  void PerformIdleTask(double deadline_in_seconds) {
+    taskrunner_->PerformIdleTask(deadline_in_seconds);
+  }
+
  private:
   class MockTaskRunner : public v8::TaskRunner {
    public:
+    explicit MockTaskRunner(bool idle_tasks_enabled)
+        : idle_tasks_enabled_(idle_tasks_enabled) {}
+
     void PostTaskImpl(std::unique_ptr<v8::Task> task,
                       const SourceLocation& location) override {
       task_ = std::move(task);
@@ -88,10 +100,11 @@ class MockPlatform : public TestPlatform {
 
     void PostIdleTaskImpl(std::unique_ptr<IdleTask> task,
                           const SourceLocation& location) override {
-      UNREACHABLE();
+      CHECK(idle_tasks_enabled_);
+      idle_task_ = std::move(task);
     }
 
-    bool IdleTasksEnabled() override { return false; }
+    bool IdleTasksEnabled() override { return idle_tasks_enabled_; }
     bool NonNestableTasksEnabled() const override { return true; }
     bool NonNestableDelayedTasksEnabled() const override { return true; }
 
@@ -102,8 +115,17 @@ class MockPlatform : public TestPlatform {
       task->Run();
     }
 
+    bool PendingIdleTask() { return idle_task_ != nullptr; }
+
+    void PerformIdleTask(double deadline_in_seconds) {
+      std::unique_ptr<IdleTask> task = std::move(idle_task_);
+      task->Run(deadline_in_seconds);
+    }
+
    private:
+    const bool idle_tasks_enabled_;
     std::unique_ptr<Task> task_;
+    std::unique_ptr<IdleTask> idle_task_;
   };
 
   std::shared_ptr<MockTaskRunner> taskrunner_;
@@ -141,6 +163,48 @@ TEST_WITH_PLATFORM(IncrementalMarkingUsingTasks, MockPlatform) {
   }
 }
 
+class MockIdlePlatform : public MockPlatform {
+ public:
+  MockIdlePlatform() : MockPlatform(true) {}
+};
+
+TEST_WITH_PLATFORM(IncrementalMarkingUsingIdleTasks, MockIdlePlatform) {
+  if (!i::v8_flags.incremental_marking) return;
+  v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  v8_flags.stress_incremental_marking = false;
+  v8_flags.incremental_marking_idle_tasks = true;
+  v8::Isolate* isolate = CcTest::isolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = CcTest::NewContext(isolate);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    Heap* heap = i_isolate->heap();
+
+    i::heap::SimulateFullSpace(heap->old_space());
+    i::IncrementalMarking* marking = heap->incremental_marking();
+    marking->Stop();
+    {
+      IsolateSafepointScope scope(heap);
+      heap->tracer()->StartCycle(
+          GarbageCollector::MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+          "collector cctest", GCTracer::MarkingType::kIncremental);
+      marking->Start(GarbageCollector::MARK_COMPACTOR,
+                     i::GarbageCollectionReason::kTesting);
+    }
+    CHECK(marking->IsMajorMarking());
+    // Marking is driven to completion purely from idle time.
+    while (marking->IsMajorMarking()) {
+      CHECK(platform.PendingIdleTask());
+      const double deadline_in_seconds =
+          (heap->MonotonicallyIncreasingTimeInMs() + 100) /
+          base::Time::kMillisecondsPerSecond;
+      platform.PerformIdleTask(deadline_in_seconds);
+    }
+    CHECK(marking->IsStopped());
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -477,6 +477,99 @@ THREADED_TEST(Access) {
   CHECK(result);
 }
 
+THREADED_TEST(GetMany) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj = CompileRun(R"(
+  ({
+    a: 1,
+    get b() { return this.a + 1; },
+    __proto__: {c: 'inherited'},
+  })
+  )")
+                              .As<v8::Object>();
+
+  Local<v8::Name> keys[] = {v8_str("a"), v8_str("b"), v8_str("c"),
+                            v8_str("missing"), v8::Symbol::New(isolate)};
+  Local<Value> values[arraysize(keys)];
+  CHECK(obj->GetMany(env.local(), v8::MemorySpan<const Local<v8::Name>>(keys),
+                     v8::MemorySpan<Local<Value>>(values))
+            .IsJust());
+  CHECK_EQ(1, values[0].As<v8::Int32>()->Value());
+  CHECK_EQ(2, values[1].As<v8::Int32>()->Value());
+  CHECK(v8_str("inherited")->Equals(env.local(), values[2]).FromJust());
+  CHECK(values[3]->IsUndefined());
+  CHECK(values[4]->IsUndefined());
+
+  // A throwing getter propagates the exception and leaves |values| unchanged.
+  Local<v8::Object> throwing = CompileRun(R"(
+  ({
+    a: 1,
+    get b() { throw new Error('b'); },
+    c: 3,
+  })
+  )")
+                                   .As<v8::Object>();
+  Local<Value> partial[3];
+  v8::TryCatch try_catch(isolate);
+  CHECK(throwing
+            ->GetMany(env.local(),
+                      v8::MemorySpan<const Local<v8::Name>>(keys, 3),
+                      v8::MemorySpan<Local<Value>>(partial))
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(partial[0].IsEmpty());
+  CHECK(partial[1].IsEmpty());
+  CHECK(partial[2].IsEmpty());
+}
+
+THREADED_TEST(SetMany) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj = CompileRun(R"(
+  ({
+    a: 1,
+    set b(v) { this.seen = v; },
+  })
+  )")
+                              .As<v8::Object>();
+
+  Local<v8::Name> keys[] = {v8_str("a"), v8_str("b"), v8_str("0"),
+                            v8_str("added")};
+  Local<Value> values[] = {v8_num(10), v8_str("setter"), v8_num(20),
+                           v8_num(30)};
+  CHECK(obj->SetMany(env.local(), v8::MemorySpan<const Local<v8::Name>>(keys),
+                     v8::MemorySpan<const Local<Value>>(values))
+            .IsJust());
+  CHECK(env->Global()->Set(env.local(), v8_str("obj"), obj).FromJust());
+  ExpectInt32("obj.a", 10);
+  ExpectString("obj.seen", "setter");
+  ExpectInt32("obj[0]", 20);
+  ExpectInt32("obj.added", 30);
+
+  // A throwing setter propagates the exception. Earlier properties are set,
+  // later ones are not.
+  Local<v8::Object> throwing = CompileRun(R"(
+  ({
+    set b(v) { throw new Error('b'); },
+  })
+  )")
+                                   .As<v8::Object>();
+  CHECK(env->Global()->Set(env.local(), v8_str("throwing"), throwing)
+            .FromJust());
+  v8::TryCatch try_catch(isolate);
+  CHECK(throwing
+            ->SetMany(env.local(), v8::MemorySpan<const Local<v8::Name>>(keys),
+                      v8::MemorySpan<const Local<Value>>(values))
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  try_catch.Reset();
+  ExpectInt32("throwing.a", 10);
+  ExpectTrue("!('added' in throwing)");
+}
+
 THREADED_TEST(AccessWithReceiver) {
   LocalContext env;
   v8::Isolate* isolate = env.isolate();
@@ -684,6 +777,48 @@ TEST(ScriptUsingOneByteStringResource) {
   CHECK_EQ(1, dispose_count);
 }
 
+TEST(NewExternalFromUtf8) {
+  int dispose_count = 0;
+  {
+    LocalContext env;
+    v8::HandleScope scope(env.isolate());
+
+    // ASCII data is used as is.
+    TestOneByteResource* ascii_resource =
+        new TestOneByteResource(i::StrDup("ascii only"), &dispose_count);
+    Local<String> ascii =
+        String::NewExternalFromUtf8(env.isolate(), ascii_resource)
+            .ToLocalChecked();
+    CHECK(ascii->IsExternalOneByte());
+    CHECK_EQ(static_cast<const String::ExternalStringResourceBase*>(
+                 ascii_resource),
+             ascii->GetExternalOneByteStringResource());
+    CHECK(ascii->StringEquals(v8_str("ascii only")));
+    CHECK_EQ(0, dispose_count);
+
+    // Other data is decoded and the resource is disposed right away.
+    const char* utf8_data = "caf\xc3\xa9 \xe2\x82\xac";
+    TestOneByteResource* utf8_resource =
+        new TestOneByteResource(i::StrDup(utf8_data), &dispose_count);
+    Local<String> utf8 =
+        String::NewExternalFromUtf8(env.isolate(), utf8_resource)
+            .ToLocalChecked();
+    CHECK_EQ(1, dispose_count);
+    CHECK(!utf8->IsExternal());
+    CHECK_EQ(6, utf8->Length());
+    CHECK(utf8->StringEquals(v8_str(utf8_data)));
+  }
+  CcTest::i_isolate()->compilation_cache()->Clear();
+  {
+    // We need to invoke GC without stack, otherwise the resource may not be
+    // reclaimed because of conservative stack scanning.
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  }
+  CHECK_EQ(2, dispose_count);
+}
+
 TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString(u"1 + 2 * 3 /* π */");
@@ -9097,6 +9232,84 @@ THREADED_TEST(StringWrite) {
   }
 }
 
+THREADED_TEST(StringUtf8Batch) {
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  v8::HandleScope scope(isolate);
+
+  const char* data[] = {"abc", "", "caf\xC3\xA9", "x\0y"};
+  const int lengths[] = {-1, 0, -1, 3};
+  v8::Local<String> strings[4];
+  CHECK(String::NewFromUtf8Batch(isolate, data, lengths, 4, strings));
+  CHECK(strings[0]->StringEquals(v8_str("abc")));
+  CHECK_EQ(0, strings[1]->Length());
+  CHECK_EQ(4, strings[2]->Length());
+  CHECK_EQ(3, strings[3]->Length());
+
+  const int too_long[] = {1, String::kMaxLength + 1};
+  CHECK(!String::NewFromUtf8Batch(isolate, data, too_long, 2, strings));
+
+  char buffer[16];
+  size_t written[4];
+  CHECK_EQ(4u, String::WriteUtf8Batch(isolate, strings, 4, buffer,
+                                      sizeof(buffer), written));
+  CHECK_EQ(3u, written[0]);
+  CHECK_EQ(0u, written[1]);
+  CHECK_EQ(5u, written[2]);
+  CHECK_EQ(3u, written[3]);
+  CHECK_EQ(0, memcmp(buffer, "abccaf\xC3\xA9x\0y", 11));
+
+  // Stops before the first string that does not fit.
+  CHECK_EQ(2u,
+           String::WriteUtf8Batch(isolate, strings, 4, buffer, 6, written));
+  CHECK_EQ(3u,
+           String::WriteUtf8Batch(isolate, strings, 4, buffer, 13, written,
+                                  String::WriteFlags::kNullTerminate));
+  CHECK_EQ(4u, written[0]);
+  CHECK_EQ(1u, written[1]);
+  CHECK_EQ(6u, written[2]);
+  CHECK_EQ(0, memcmp(buffer, "abc\0\0caf\xC3\xA9\0", 11));
+}
+
+THREADED_TEST(StringUtf8StreamDecoder) {
+  LocalContext context;
+  v8::Isolate* isolate = context.isolate();
+  v8::HandleScope scope(isolate);
+
+  // ASCII, Latin-1, BMP, supplementary and invalid/truncated sequences.
+  const char* cases[] = {"abc",
+                         "caf\xC3\xA9",
+                         "\xE2\x82\xAC1",
+                         "a\xF0\x9F\x98\x80b",
+                         "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80",
+                         "\xE2\x82x\xFF\xC3",
+                         "\xF0\x9F\x98"};
+  String::Utf8StreamDecoder decoder;
+  for (const char* data : cases) {
+    size_t length = strlen(data);
+    Local<String> expected =
+        String::NewFromUtf8(isolate, data, v8::NewStringType::kNormal,
+                            static_cast<int>(length))
+            .ToLocalChecked();
+    // Split the input into two chunks at every position.
+    for (size_t split = 0; split <= length; split++) {
+      decoder.Append(data, split);
+      decoder.Append(data + split, length - split);
+      Local<String> result = decoder.Finish(isolate).ToLocalChecked();
+      CHECK(result->StringEquals(expected));
+      CHECK_EQ(expected->IsOneByte(), result->IsOneByte());
+    }
+    // Feed the input byte by byte.
+    for (size_t i = 0; i < length; i++) decoder.Append(data + i, 1);
+    Local<String> result =
+        decoder.Finish(isolate, v8::NewStringType::kInternalized)
+            .ToLocalChecked();
+    CHECK(result->StringEquals(expected));
+    CHECK(IsInternalizedString(*v8::Utils::OpenDirectHandle(*result)));
+  }
+  CHECK_EQ(0, decoder.Finish(isolate).ToLocalChecked()->Length());
+}
+
 static void Utf16Helper(LocalContext& context, const char* name,
                         const char* lengths_name, int len) {
   Local<v8::Array> a = Local<v8::Array>::Cast(
@@ -21637,6 +21850,66 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class StringOutputSink final : public v8::JSON::OutputSink {
+ public:
+  void Write(const char* data, size_t length) override {
+    CHECK_GT(length, 0);
+    result_.append(data, length);
+    chunks_++;
+  }
+
+  const std::string& result() const { return result_; }
+  int chunks() const { return chunks_; }
+
+ private:
+  std::string result_;
+  int chunks_ = 0;
+};
+
+void TestJSONStringifyToUtf8(v8::Local<v8::Context> context,
+                             const char* source) {
+  Local<Value> value = CompileRun(source);
+  StringOutputSink sink;
+  CHECK(v8::JSON::StringifyToUtf8(context, value, &sink).FromJust());
+  Local<String> expected =
+      v8::JSON::Stringify(context, value).ToLocalChecked();
+  v8::String::Utf8Value utf8(context->GetIsolate(), expected);
+  CHECK_EQ(std::string(*utf8, utf8.length()), sink.result());
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  TestJSONStringifyToUtf8(context.local(), "({x: 42, y: [1, 'a', null]})");
+  TestJSONStringifyToUtf8(context.local(), "({'\\u00e9': '\\u00fc\\n'})");
+  TestJSONStringifyToUtf8(context.local(),
+                          "['\\u2603', '\\ud83d\\ude00', '\\ud800']");
+  // Large enough to require several output chunks, with a surrogate pair
+  // at every possible position relative to a chunk boundary.
+  TestJSONStringifyToUtf8(context.local(),
+                          "Array(5000).fill('a\\ud83d\\ude00bc\\u00e9')");
+  // Goes through the slow path.
+  TestJSONStringifyToUtf8(context.local(),
+                          "({toJSON() { return {'\\u00e9': 1}; }})");
+
+  StringOutputSink sink;
+  CHECK(!v8::JSON::StringifyToUtf8(context.local(), v8::Undefined(
+                                                        context.isolate()),
+                                   &sink)
+             .FromJust());
+  CHECK_EQ(0, sink.chunks());
+
+  v8::TryCatch try_catch(context.isolate());
+  Local<Value> cyclic = CompileRun("var o = {}; o.o = o; o");
+  CHECK(v8::JSON::StringifyToUtf8(context.local(), cyclic, &sink).IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, sink.chunks());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -24091,6 +24364,103 @@ void RunStreamingTest(const char** chunks,
                    expected_source_url, expected_source_mapping_url);
 }
 
+TEST(CompileBatch) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+
+  const char* kSources[] = {"var a = 6; a;", "var b = a * 7; b;",
+                            "'\\u00e9'.length + b;"};
+  std::vector<std::unique_ptr<v8::ScriptCompiler::Source>> sources;
+  std::vector<v8::ScriptCompiler::Source*> source_ptrs;
+  for (const char* source : kSources) {
+    sources.push_back(
+        std::make_unique<v8::ScriptCompiler::Source>(v8_str(source)));
+    source_ptrs.push_back(sources.back().get());
+  }
+  std::vector<v8::Local<v8::Script>> scripts(sources.size());
+  CHECK(v8::ScriptCompiler::CompileBatch(
+            env.local(), v8::MemorySpan<v8::ScriptCompiler::Source* const>(
+                             source_ptrs.data(), source_ptrs.size()),
+            v8::MemorySpan<v8::Local<v8::Script>>(scripts.data(),
+                                                  scripts.size()))
+            .IsJust());
+  const int kExpected[] = {6, 42, 43};
+  for (size_t i = 0; i < scripts.size(); i++) {
+    CHECK(!scripts[i].IsEmpty());
+    CHECK_EQ(kExpected[i], scripts[i]
+                               ->Run(env.local())
+                               .ToLocalChecked()
+                               ->Int32Value(env.local())
+                               .FromJust());
+  }
+}
+
+TEST(CompileBatchExternalSources) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+
+  // External strings are compiled on worker threads, the on-heap string on
+  // the main thread. The options apply to both.
+  const char* kOneByte = "(function f1() { return 1; })";
+  const char* kTwoByte = "(function f2() { return 2; })";
+  const char* kOnHeap = "(function f3() { return 3; })";
+  v8::ScriptCompiler::Source one_byte(
+      String::NewExternalOneByte(isolate,
+                                 new TestOneByteResource(i::StrDup(kOneByte)))
+          .ToLocalChecked());
+  v8::ScriptCompiler::Source two_byte(
+      String::NewExternalTwoByte(
+          isolate, new TestResource(AsciiToTwoByteString(kTwoByte)))
+          .ToLocalChecked());
+  v8::ScriptCompiler::Source on_heap(v8_str(kOnHeap));
+  v8::ScriptCompiler::Source* sources[] = {&one_byte, &two_byte, &on_heap};
+  v8::Local<v8::Script> scripts[3];
+  CHECK(v8::ScriptCompiler::CompileBatch(
+            env.local(),
+            v8::MemorySpan<v8::ScriptCompiler::Source* const>(sources, 3),
+            v8::MemorySpan<v8::Local<v8::Script>>(scripts, 3),
+            v8::ScriptCompiler::kEagerCompile)
+            .IsJust());
+  for (int i = 0; i < 3; i++) {
+    v8::Local<v8::Value> result =
+        scripts[i]->Run(env.local()).ToLocalChecked();
+    CHECK(result->IsFunction());
+    // kEagerCompile was forwarded, so the inner functions are compiled.
+    i::DirectHandle<i::JSFunction> function = i::Cast<i::JSFunction>(
+        v8::Utils::OpenDirectHandle(*result.As<v8::Function>()));
+    CHECK(function->shared()->is_compiled());
+    CHECK_EQ(i + 1, result.As<v8::Function>()
+                        ->Call(env.local(), env->Global(), 0, nullptr)
+                        .ToLocalChecked()
+                        ->Int32Value(env.local())
+                        .FromJust());
+  }
+}
+
+TEST(CompileBatchWithSyntaxError) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  v8::ScriptCompiler::Source first(v8_str("1 + 1"));
+  v8::ScriptCompiler::Source broken(v8_str("function ("));
+  v8::ScriptCompiler::Source last(v8_str("2 + 2"));
+  v8::ScriptCompiler::Source* sources[] = {&first, &broken, &last};
+  v8::Local<v8::Script> scripts[3];
+  CHECK(v8::ScriptCompiler::CompileBatch(
+            env.local(),
+            v8::MemorySpan<v8::ScriptCompiler::Source* const>(sources, 3),
+            v8::MemorySpan<v8::Local<v8::Script>>(scripts, 3))
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(!scripts[0].IsEmpty());
+  CHECK(scripts[1].IsEmpty());
+  CHECK(scripts[2].IsEmpty());
+}
+
 TEST(StreamingSimpleScript) {
   // This script is unrealistically small, since no one chunk is enough to fill
   // the backing buffer of Scanner, let alone overflow it.
@@ -3401,6 +3401,50 @@ TEST(DebuggerUnload) {
   CheckDebuggerUnloaded();
 }
 
+TEST(CollectICFeedbackSummaries) {
+  i::v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<v8::Script> script = CompileWithOrigin(
+      "function mono(o) { return o.x; }\n"
+      "function poly(o) { return o.x; }\n"
+      "function mega(o) { return o.x; }\n"
+      "%EnsureFeedbackVectorForFunction(mono);\n"
+      "%EnsureFeedbackVectorForFunction(poly);\n"
+      "%EnsureFeedbackVectorForFunction(mega);\n"
+      "for (let i = 0; i < 10; i++) mono({x: i});\n"
+      "poly({x: 1}); poly({x: 1, y: 2});\n"
+      "for (let i = 0; i < 10; i++) mega({['p' + i]: 0, x: i});\n",
+      "test", false);
+  script->Run(env.local()).ToLocalChecked();
+  int script_id = script->GetUnboundScript()->GetId();
+
+  std::vector<v8::debug::ICFeedbackSummary> summaries =
+      v8::debug::CollectICFeedbackSummaries(isolate);
+  bool found_poly = false;
+  bool found_mega = false;
+  for (const v8::debug::ICFeedbackSummary& summary : summaries) {
+    if (summary.script_id != script_id) continue;
+    // Summaries are only reported for vectors with non-monomorphic sites.
+    CHECK(summary.polymorphic_sites > 0 || summary.megamorphic_sites > 0);
+    // poly and mega are identified by their invocation counts; mono must not
+    // show up at all.
+    if (summary.invocation_count == 2) {
+      CHECK_EQ(1, summary.polymorphic_sites);
+      CHECK_EQ(0, summary.megamorphic_sites);
+      found_poly = true;
+    } else if (summary.invocation_count == 10) {
+      CHECK_EQ(0, summary.polymorphic_sites);
+      CHECK_EQ(1, summary.megamorphic_sites);
+      found_mega = true;
+    }
+  }
+  CHECK(found_poly);
+  CHECK(found_mega);
+}
+
 int event_listener_hit_count = 0;
 
 // Test for issue http://code.google.com/p/v8/issues/detail?id=289.
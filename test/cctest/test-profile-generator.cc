@@ -364,6 +364,49 @@ TEST(CodeMapMoveAndDeleteCode) {
   CHECK_EQ(entry1, instruction_stream_map.FindEntry(ToAddress(0x1700)));
 }
 
+TEST(CodeMapLookupCacheInvalidation) {
+  CodeEntryStorage storage;
+  InstructionStreamMap instruction_stream_map(storage);
+  CodeEntry* entry1 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "aaa");
+  CodeEntry* entry2 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "bbb");
+  instruction_stream_map.AddCode(ToAddress(0x1500), entry1, 0x200);
+  // Repeated lookups of the same address are served from the lookup cache.
+  Address start = kNullAddress;
+  CHECK_EQ(entry1,
+           instruction_stream_map.FindEntry(ToAddress(0x1600), &start));
+  CHECK_EQ(ToAddress(0x1500), start);
+  start = kNullAddress;
+  CHECK_EQ(entry1,
+           instruction_stream_map.FindEntry(ToAddress(0x1600), &start));
+  CHECK_EQ(ToAddress(0x1500), start);
+  // Mutations must not leave stale results behind.
+  instruction_stream_map.MoveCode(ToAddress(0x1500), ToAddress(0x2500));
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x1600)));
+  CHECK_EQ(entry1, instruction_stream_map.FindEntry(ToAddress(0x2600)));
+  instruction_stream_map.ClearCodesInRange(ToAddress(0x2500),
+                                           ToAddress(0x2700));
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x2600)));
+  instruction_stream_map.AddCode(ToAddress(0x2500), entry2, 0x200);
+  CHECK_EQ(entry2, instruction_stream_map.FindEntry(ToAddress(0x2600)));
+  // Adding code below a cached address can shadow the cached entry.
+  CodeEntry* entry3 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "ccc");
+  CodeEntry* entry4 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "ddd");
+  instruction_stream_map.AddCode(ToAddress(0x1000), entry3, 0x400);
+  CHECK_EQ(entry3, instruction_stream_map.FindEntry(ToAddress(0x1100)));
+  instruction_stream_map.AddCode(ToAddress(0x1080), entry4, 0x40);
+  CHECK(!instruction_stream_map.FindEntry(ToAddress(0x1100)));
+  // Unrelated mutations leave other cached results intact and correct.
+  CHECK_EQ(entry2, instruction_stream_map.FindEntry(ToAddress(0x2600)));
+  instruction_stream_map.ClearCodesInRange(ToAddress(0x1080),
+                                           ToAddress(0x10c0));
+  CHECK_EQ(entry2, instruction_stream_map.FindEntry(ToAddress(0x2600)));
+  CHECK_EQ(entry3, instruction_stream_map.FindEntry(ToAddress(0x1100)));
+}
+
 TEST(CodeMapClear) {
   CodeEntryStorage storage;
   InstructionStreamMap instruction_stream_map(storage);
@@ -2,12 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "include/v8-function.h"
 #include "include/v8-regexp.h"
 #include "src/api/api-inl.h"
 #include "src/execution/frames-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 using namespace v8;
 
@@ -348,3 +351,45 @@ TEST(InterruptAndTransitionSubjectFromTwoByteToOneByte) {
       CheckedCast<i::IrRegExpData>(regexp->data(i_isolate));
   CHECK(data->has_latin1_bytecode());
 }
+
+namespace {
+
+std::vector<uint8_t> CompileAndGetLatin1Bytecode(v8::Isolate* isolate) {
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  LocalContext context(isolate);
+  v8::Local<Value> result = CompileRun(
+      "var re = /(\\d+)-([a-z]+)/g;"
+      "'12-ab 3-c'.replace(re, '$2$1')");
+  CHECK(result->IsString());
+  CHECK(result.As<String>()->StringEquals(v8_str("ab12 c3")));
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::DirectHandle<i::JSRegExp> regexp =
+      Utils::OpenDirectHandle(*CompileRun("re").As<RegExp>());
+  i::Tagged<i::IrRegExpData> data =
+      CheckedCast<i::IrRegExpData>(regexp->data(i_isolate));
+  CHECK(data->has_latin1_bytecode());
+  i::Tagged<i::TrustedByteArray> bytecode = data->bytecode(true);
+  return std::vector<uint8_t>(bytecode->begin(), bytecode->end());
+}
+
+}  // namespace
+
+UNINITIALIZED_TEST(SharedBytecodeCacheAcrossIsolates) {
+  i::FlagScope<bool> shared_bytecode_cache(
+      &i::v8_flags.regexp_shared_bytecode_cache, true);
+  i::FlagScope<bool> interpret_all(&i::v8_flags.regexp_interpret_all, true);
+  i::FlagScope<bool> no_tier_up(&i::v8_flags.regexp_tier_up, false);
+
+  std::vector<uint8_t> bytecodes[2];
+  for (std::vector<uint8_t>& bytecode : bytecodes) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    bytecode = CompileAndGetLatin1Bytecode(isolate);
+    isolate->Dispose();
+  }
+  CHECK(!bytecodes[0].empty());
+  CHECK(bytecodes[0] == bytecodes[1]);
+}
@@ -73,6 +73,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 namespace v8 {
 namespace internal {
 
@@ -1785,6 +1786,48 @@ TEST(CodeSerializerWithProfiler) {
   delete cache;
 }
 
+TEST(CodeSerializerTieringDecision) {
+  FlagScope<bool> pgo(&v8_flags.profile_guided_optimization, true);
+  FlagScope<bool> pgo_in_code_cache(
+      &v8_flags.profile_guided_optimization_in_code_cache, true);
+
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "1 + 1";
+
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptDetails default_script_details;
+  DirectHandle<SharedFunctionInfo> orig =
+      CompileScript(isolate, orig_source, default_script_details, nullptr,
+                    v8::ScriptCompiler::kNoCompileOptions);
+  orig->set_cached_tiering_decision(CachedTieringDecision::kEarlyMaglev);
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  // Serialization must not change the decision of the live function.
+  CHECK_EQ(CachedTieringDecision::kEarlyMaglev,
+           orig->cached_tiering_decision());
+
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+  DirectHandle<SharedFunctionInfo> copy =
+      CompileScript(isolate, copy_source, default_script_details, &cache,
+                    v8::ScriptCompiler::kConsumeCodeCache);
+  CHECK_NE(*orig, *copy);
+  CHECK_EQ(CachedTieringDecision::kEarlyMaglev,
+           copy->cached_tiering_decision());
+}
+
 void TestCodeSerializerOnePlusOneImpl(bool verify_builtins_count = true) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
@@ -3009,6 +3052,213 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerBundle) {
+  const char* js_sources[] = {"function f() { return 'abc'; }; f() + 'def'",
+                              "var g = () => 'ab'; g() + 'cdef'"};
+  v8::ScriptCompiler::CachedData* caches[] = {
+      CompileRunAndProduceCache(js_sources[0]),
+      CompileRunAndProduceCache(js_sources[1])};
+  std::unique_ptr<v8::ScriptCompiler::CachedData> bundle(
+      ScriptCompiler::CreateCodeCacheBundle(
+          v8::MemorySpan<const v8::ScriptCompiler::CachedData* const>(caches,
+                                                                      2)));
+  for (v8::ScriptCompiler::CachedData* cache : caches) delete cache;
+  CHECK(IsAligned(reinterpret_cast<intptr_t>(bundle->data), kPointerAlignment));
+  CHECK_NULL(ScriptCompiler::GetCodeCacheFromBundle(bundle.get(), 2));
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    for (size_t i = 0; i < arraysize(js_sources); i++) {
+      v8::ScriptCompiler::CachedData* cache =
+          ScriptCompiler::GetCodeCacheFromBundle(bundle.get(), i);
+      CHECK_NOT_NULL(cache);
+      // Entries reference the bundle instead of copying it.
+      CHECK_GE(cache->data, bundle->data);
+      CHECK_LE(cache->data + cache->length, bundle->data + bundle->length);
+      CHECK(IsAligned(reinterpret_cast<intptr_t>(cache->data),
+                      kPointerAlignment));
+
+      v8::ScriptOrigin origin(v8_str("test"));
+      v8::ScriptCompiler::Source source(v8_str(js_sources[i]), origin, cache);
+      v8::Local<v8::UnboundScript> script;
+      {
+        DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+        script = v8::ScriptCompiler::CompileUnboundScript(
+                     isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                     .ToLocalChecked();
+      }
+      CHECK(!cache->rejected);
+      v8::Local<v8::Value> result =
+          script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      CHECK(result->ToString(context)
+                .ToLocalChecked()
+                ->Equals(context, v8_str("abcdef"))
+                .FromJust());
+    }
+  }
+  isolate2->Dispose();
+
+  // A corrupted index is rejected.
+  const_cast<uint8_t*>(bundle->data)[i::CodeCacheBundle::kIndexOffset] ^= 1;
+  CHECK_NULL(ScriptCompiler::GetCodeCacheFromBundle(bundle.get(), 0));
+}
+
+TEST(CodeSerializerLazyFunctions) {
+  bool prev_code_cache_lazy_functions = v8_flags.code_cache_lazy_functions;
+  int prev_bytecode_old_age = v8_flags.bytecode_old_age;
+  v8_flags.code_cache_lazy_functions = true;
+  // Treat all inner functions as old.
+  v8_flags.bytecode_old_age = 0;
+
+  const char* js_source =
+      "function f() {"
+      "  return function g() {"
+      "    return 'abc';"
+      "  }"
+      "}"
+      "f()() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kEager);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the top-level function was deserialized with bytecode.
+    DirectHandle<SharedFunctionInfo> toplevel =
+        v8::Utils::OpenDirectHandle(*script);
+    CHECK(toplevel->is_compiled());
+    {
+      DisallowGarbageCollection no_gc;
+      SharedFunctionInfo::ScriptIterator iter(
+          i_isolate2, Cast<Script>(toplevel->script()));
+      int inner_functions = 0;
+      for (Tagged<SharedFunctionInfo> sfi = iter.Next(); !sfi.is_null();
+           sfi = iter.Next()) {
+        if (sfi->is_toplevel()) continue;
+        CHECK(!sfi->is_compiled());
+        inner_functions++;
+      }
+      CHECK_EQ(2, inner_functions);
+    }
+
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+
+  v8_flags.code_cache_lazy_functions = prev_code_cache_lazy_functions;
+  v8_flags.bytecode_old_age = prev_bytecode_old_age;
+}
+
+namespace {
+
+AllocationSite::PretenureDecision LiteralSiteDecision(
+    v8::Local<v8::Context> context, const char* name) {
+  DirectHandle<JSFunction> function = Cast<JSFunction>(
+      v8::Utils::OpenDirectHandle(*context->Global()
+                                       ->Get(context, v8_str(name))
+                                       .ToLocalChecked()));
+  Tagged<FeedbackVector> vector = function->feedback_vector();
+  DisallowGarbageCollection no_gc;
+  FeedbackMetadataIterator iter(vector->metadata(), no_gc);
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (iter.kind() != FeedbackSlotKind::kLiteral) continue;
+    return Cast<AllocationSite>(vector->Get(slot).GetHeapObjectAssumeStrong())
+        ->pretenure_decision();
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+TEST(PretenuringHints) {
+  if (v8_flags.single_generation) return;
+  bool prev_allow_natives_syntax = v8_flags.allow_natives_syntax;
+  bool prev_lazy_feedback_allocation = v8_flags.lazy_feedback_allocation;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.lazy_feedback_allocation = false;
+
+  const char* js_source = "function f() { return {a: [1, 2]}; }";
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate1 = CcTest::isolate();
+  v8::ScriptCompiler::CachedData* hints;
+  {
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+    v8::ScriptCompiler::Source source(v8_str(js_source));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun("%PretenureAllocationSite(f());");
+    heap::InvokeMajorGC(CcTest::heap());
+    CHECK_EQ(AllocationSite::kTenure, LiteralSiteDecision(context, "f"));
+    hints = v8::ScriptCompiler::CreatePretenuringHints(script);
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // Hints for a different source are rejected.
+    v8::ScriptCompiler::Source other_source(v8_str("function f() {}"));
+    v8::Local<v8::UnboundScript> other_script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate2, &other_source)
+            .ToLocalChecked();
+    CHECK(!v8::ScriptCompiler::SetPretenuringHints(other_script, hints));
+
+    v8::ScriptCompiler::Source source(v8_str(js_source));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate2, &source)
+            .ToLocalChecked();
+    CHECK(v8::ScriptCompiler::SetPretenuringHints(script, hints));
+    // Hints of live scripts survive full GCs.
+    heap::InvokeMajorGC(reinterpret_cast<Isolate*>(isolate2)->heap());
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun("f();");
+    CHECK_EQ(AllocationSite::kTenure, LiteralSiteDecision(context, "f"));
+  }
+  isolate2->Dispose();
+  delete hints;
+
+  v8_flags.allow_natives_syntax = prev_allow_natives_syntax;
+  v8_flags.lazy_feedback_allocation = prev_lazy_feedback_allocation;
+}
+
 TEST(CodeSerializerAfterExecute) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache =
@@ -6764,5 +7014,43 @@ UNINITIALIZED_TEST(StaticRootsPredictableSnapshot) {
 #endif  // defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE) &&
         // defined(V8_SHARED_RO_HEAP)
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+UNINITIALIZED_TEST(CacheDecompressedContextSnapshots) {
+  FlagScope<bool> cache_snapshots(
+      &v8_flags.cache_decompressed_context_snapshots, true);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    CHECK(i_isolate->decompressed_context_snapshot(0).empty());
+
+    // The first context decompresses the snapshot and caches the result.
+    v8::Local<v8::Context> first = v8::Context::New(isolate);
+    base::Vector<const uint8_t> cached =
+        i_isolate->decompressed_context_snapshot(0);
+    CHECK(!cached.empty());
+
+    // The second context is deserialized from the cached data.
+    v8::Local<v8::Context> second = v8::Context::New(isolate);
+    CHECK_EQ(cached.begin(),
+             i_isolate->decompressed_context_snapshot(0).begin());
+    CHECK_EQ(cached.size(),
+             i_isolate->decompressed_context_snapshot(0).size());
+    CHECK(first != second);
+    {
+      v8::Context::Scope context_scope(second);
+      CHECK_EQ(4, CompileRun("[1, 2, 3].map(v => v + 1)[2]")
+                      ->Int32Value(second)
+                      .FromJust());
+    }
+  }
+  isolate->Dispose();
+}
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 }  // namespace internal
 }  // namespace v8
@@ -450,6 +450,9 @@ void TestConcurrentInternalization(TestHitOrMiss hit_or_miss) {
       CreateSharedOneByteStrings(i_isolate, factory, kStrings - kLOStrings,
                                  kLOStrings, 2, hit_or_miss == kTestHit);
 
+  const StringTable::WriteStats stats_before =
+      i_isolate->string_table()->GetWriteStats();
+
   ParkingSemaphore sema_ready(0);
   ParkingSemaphore sema_execute_start(0);
   ParkingSemaphore sema_execute_complete(0);
@@ -474,6 +477,18 @@ void TestConcurrentInternalization(TestHitOrMiss hit_or_miss) {
   }
 
   ParkingThread::ParkedJoinAll(local_isolate, threads);
+
+  // Each string is inserted at most once, no matter how many threads race to
+  // internalize it.
+  const StringTable::WriteStats stats_after =
+      i_isolate->string_table()->GetWriteStats();
+  const size_t insertions = stats_after.insertions - stats_before.insertions;
+  if (hit_or_miss == kTestHit) {
+    CHECK_EQ(size_t{0}, insertions);
+  } else {
+    CHECK_LT(size_t{0}, insertions);
+    CHECK_LE(insertions, static_cast<size_t>(kStrings));
+  }
 }
 }  // namespace
 
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <vector>
+
 #include "include/v8-json.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
@@ -41,6 +43,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -613,6 +616,32 @@ TEST(ConsStringWithEmptyFirstFlatten) {
   CHECK_EQ(initial_length, flat->length());
 }
 
+TEST(ConsStringOfFlattenedConsString) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  Handle<String> fst = factory->NewStringFromAsciiChecked("fst012345");
+  Handle<String> snd = factory->NewStringFromAsciiChecked("snd012345");
+  Handle<String> inner = factory->NewConsString(fst, snd).ToHandleChecked();
+  CHECK(IsConsString(*inner));
+  DirectHandle<String> flat = String::Flatten(isolate, inner);
+  CHECK(Cast<ConsString>(*inner)->IsFlat());
+
+  // Concatenating a flattened cons string refers to its flat contents instead
+  // of nesting the cons string.
+  Handle<String> outer = factory->NewConsString(inner, snd).ToHandleChecked();
+  CHECK(IsConsString(*outer));
+  CHECK_EQ(*flat, Cast<ConsString>(*outer)->first());
+  outer = factory->NewConsString(fst, inner).ToHandleChecked();
+  CHECK(IsConsString(*outer));
+  CHECK_EQ(*flat, Cast<ConsString>(*outer)->second());
+  CHECK(String::Equals(
+      isolate, factory->NewStringFromAsciiChecked("fst012345fst012345snd012345"),
+      outer));
+}
+
 static void VerifyCharacterStream(Tagged<String> flat_string,
                                   Tagged<String> cons_string) {
   // Do not want to test ConString traversal on flat string.
@@ -1886,6 +1915,34 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashTwoByteLatin1Strings) {
+  CcTest::InitializeVM();
+  i::Isolate* isolate = CcTest::i_isolate();
+  const HashSeed seed(isolate);
+
+  // Two-byte strings that only contain Latin-1 characters must hash like their
+  // one-byte counterparts, no matter where the last non-Latin-1 character was.
+  for (uint32_t length = 1; length <= 40; length++) {
+    std::vector<uint8_t> one_byte(length);
+    std::vector<uint16_t> two_byte(length);
+    for (uint32_t i = 0; i < length; i++) {
+      one_byte[i] = static_cast<uint8_t>('a' + (i % 26) + (i % 2) * 0x80);
+      two_byte[i] = one_byte[i];
+    }
+    const uint32_t one_byte_hash =
+        StringHasher::HashSequentialString(one_byte.data(), length, seed);
+    CHECK_EQ(one_byte_hash,
+             StringHasher::HashSequentialString(two_byte.data(), length, seed));
+
+    CHECK(detail::IsOnly8Bit(two_byte.data(), length));
+    for (uint32_t i = 0; i < length; i++) {
+      two_byte[i] = 0x100 + one_byte[i];
+      CHECK(!detail::IsOnly8Bit(two_byte.data(), length));
+      two_byte[i] = one_byte[i];
+    }
+  }
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
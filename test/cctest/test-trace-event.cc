@@ -67,7 +67,8 @@ class MockTracingController : public v8::TracingController {
                                 const char* name, uint64_t handle) override {}
 
   const uint8_t* GetCategoryGroupEnabled(const char* name) override {
-    if (strncmp(name, "v8-cat", 6)) {
+    if (strncmp(name, "v8-cat", 6) &&
+        strcmp(name, TRACE_DISABLED_BY_DEFAULT("v8.deopt"))) {
       static uint8_t no = 0;
       return &no;
     } else {
@@ -361,3 +362,32 @@ TEST_WITH_PLATFORM(BuiltinsTrace, MockTracingPlatform) {
     CHECK_EQ(1, platform.GetTraceObject(1)->num_args);
   }
 }
+
+TEST_WITH_PLATFORM(DeoptimizationTraceEvent, MockTracingPlatform) {
+  if (i::v8_flags.jitless || !i::v8_flags.turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  CcTest::InitializeVM();
+
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  LocalContext env;
+
+  CompileRun(
+      "function f(x) { return x + 1; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1);"
+      "f(2);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(3);"
+      "f('a');");
+
+  size_t deopt_events = 0;
+  for (size_t i = 0; i < platform.NumberOfTraceObjects(); i++) {
+    MockTraceObject* object = platform.GetTraceObject(i);
+    if (object->name != "V8.Deoptimize") continue;
+    CHECK_EQ(TRACE_EVENT_PHASE_INSTANT, object->phase);
+    CHECK_EQ(1, object->num_args);
+    deopt_events++;
+  }
+  CHECK_LE(1, deopt_events);
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packed numeric arrays sorted with (a, b) => a - b or (a, b) => b - a are
+// sorted without calling the comparison function.
+function reference(array, cmp) {
+  // Sort a generic copy so that the native path is not taken.
+  const copy = Array.from(array, x => ({x}));
+  copy.sort((a, b) => cmp(a.x, b.x));
+  return copy.map(o => o.x);
+}
+
+function assertSorted(array, cmp) {
+  const expected = reference(array, cmp);
+  const result = array.sort(cmp);
+  assertSame(array, result);
+  assertEquals(expected.length, array.length);
+  for (let i = 0; i < array.length; i++) {
+    assertTrue(Object.is(expected[i], array[i]), `${i}`);
+  }
+}
+
+const smis = [];
+const doubles = [];
+for (let i = 0; i < 200; i++) {
+  smis.push((i * 7919) % 1013 - 500);
+  doubles.push(((i * 7919) % 1013 - 500) / 4);
+}
+doubles.push(-0, 0, -0, Infinity, -Infinity, 0);
+
+assertSorted(smis.slice(), (a, b) => a - b);
+assertSorted(smis.slice(), (a, b) => b - a);
+assertSorted(doubles.slice(), (a, b) => a - b);
+assertSorted(doubles.slice(), (a, b) => b - a);
+assertSorted(doubles.slice(), function(x, y) { return x - y; });
+assertSorted([2 ** 30 - 1, -(2 ** 30), 0, 1, -1], (a, b) => a - b);
+
+// -0 and +0 compare equal and keep their relative order.
+const zeros = [0, -0, 1, -0, 0];
+zeros.sort((a, b) => a - b);
+assertTrue(Object.is(0, zeros[0]));
+assertTrue(Object.is(-0, zeros[1]));
+assertTrue(Object.is(-0, zeros[2]));
+assertTrue(Object.is(0, zeros[3]));
+assertEquals(1, zeros[4]);
+
+// NaN makes the comparison inconsistent; the result is still a permutation.
+const withNaN = [3, NaN, 1.5, 2];
+withNaN.sort((a, b) => a - b);
+assertEquals(4, withNaN.length);
+assertTrue(withNaN.some(Number.isNaN));
+
+// Comparison functions that are not plain subtractions are still called.
+let calls = 0;
+[3, 1, 2].sort((a, b) => { calls++; return a - b; });
+assertTrue(calls > 0);
+calls = 0;
+[3, 1, 2].sort((a, b) => a - b + (calls++, 0));
+assertTrue(calls > 0);
+assertEquals([1, 2, 3], [3, 1, 2].sort((a, b, c) => a - b));
+
+// Copy-on-write literals are copied before sorting.
+function literal() { return [5, 4, 3, 2, 1]; }
+assertEquals([1, 2, 3, 4, 5], literal().sort((a, b) => a - b));
+assertEquals([5, 4, 3, 2, 1], literal());
@@ -0,0 +1,38 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --async-stack-traces
+
+// The await closures of an async function are reused across awaits; resuming
+// with values and exceptions must keep working for every await.
+async function sum(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    result += await i;
+    try {
+      await Promise.reject(i);
+    } catch (e) {
+      result -= e;
+    }
+    result += await Promise.resolve(1);
+  }
+  return result;
+}
+
+async function inner() {
+  await 1;
+  await 2;
+  throw new Error('inner');
+}
+
+async function outer() {
+  await 0;
+  await inner();
+}
+
+let log = [];
+sum(100).then(v => log.push(v));
+outer().catch(e => log.push(e.stack.includes('at async outer')));
+%PerformMicrotaskCheckpoint();
+assertEquals([100, true], log);
@@ -0,0 +1,24 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --allow-natives-syntax
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-threshold=1
+// Flags: --concurrent-sparkplug --concurrent-sparkplug-install-budget-us=1
+// Flags: --invocation-count-for-feedback-allocation=1 --lazy-feedback-allocation
+// Flags: --no-stress-concurrent-inlining
+
+// With a tiny install budget, installing concurrently compiled code is spread
+// over many interrupts, but eventually all functions get their code.
+const functions = [];
+for (let i = 0; i < 20; i++) {
+  const f = new Function('a', 'b', `return (a + b + ${i}) * 42 / a % b;`);
+  %NeverOptimizeFunction(f);
+  functions.push(f);
+}
+
+let keep_going = 1000000;  // A counter to avoid test hangs on failure.
+while (--keep_going > 0 && !functions.every(f => isBaseline(f))) {
+  for (const f of functions) f(1, 2);
+}
+assertTrue(keep_going > 0);
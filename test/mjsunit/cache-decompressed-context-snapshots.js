@@ -0,0 +1,15 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --cache-decompressed-context-snapshots
+
+// Contexts created from the same cached snapshot data are independent.
+for (let i = 0; i < 10; i++) {
+  const realm = Realm.create();
+  assertEquals('undefined', Realm.eval(realm, 'typeof x'));
+  Realm.eval(realm, `var x = ${i};`);
+  assertEquals(i, Realm.eval(realm, 'x'));
+  assertEquals(4, Realm.eval(realm, '[1, 2, 3].map(v => v + 1)[2]'));
+  Realm.dispose(realm);
+}
@@ -0,0 +1,31 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the block-wise skipping of comment bodies with interesting
+// characters at every position relative to a block boundary.
+for (let i = 0; i < 24; i++) {
+  const prefix = 'x'.repeat(i);
+
+  assertEquals(1, eval(`//${prefix}\n1`));
+  assertEquals(1, eval(`//${prefix}\r1`));
+  assertEquals(1, eval(`//${prefix}\u2028 1`));
+  assertEquals(1, eval(`//${prefix}\u2029 1`));
+  assertEquals(1, eval(`1;//${prefix}\u2027${prefix}`));
+  assertEquals(1, eval(`1;//${prefix}*/${prefix}`));
+
+  assertEquals(1, eval(`/*${prefix}*/1`));
+  assertEquals(1, eval(`/*${prefix}*${prefix}**/1`));
+  assertEquals(1, eval(`/*${prefix}\u2027${prefix}*/1`));
+  assertThrows(() => eval(`/*${prefix}*`), SyntaxError);
+  assertThrows(() => eval(`/*${prefix}`), SyntaxError);
+
+  // A line terminator inside a multi-line comment counts for ASI.
+  for (const lt of ['\n', '\r', '\u2028', '\u2029']) {
+    assertEquals(2, eval(`var a = 1\n/*${prefix}${lt}${prefix}*/a = 2; a`));
+    assertEquals(3, eval(`var b = 3/*${prefix}${lt}${prefix}*/b`));
+    assertEquals(4, eval(
+        `var c = 4/*${prefix}${lt}${prefix}*${prefix}*/\n/*${prefix}*/c`));
+  }
+  assertThrows(() => eval(`var d = 1/*${prefix}*/d`), SyntaxError);
+}
@@ -0,0 +1,25 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan
+// Flags: --turbo-regalloc-skip-optimizations-threshold=1
+
+function f(a, b, n) {
+  let x = 0, y = 1.5, z = 'z';
+  for (let i = 0; i < n; i++) {
+    if (i & 1) {
+      x += a[i % a.length];
+    } else {
+      y *= b;
+      z += i;
+    }
+  }
+  return [x, y, z];
+}
+
+%PrepareFunctionForOptimization(f);
+const expected = f([1, 2, 3], 1.25, 10);
+f([1, 2, 3], 1.25, 10);
+%OptimizeFunctionOnNextCall(f);
+assertEquals(expected, f([1, 2, 3], 1.25, 10));
@@ -0,0 +1,23 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings in the toISOString format round-trip.
+for (const time of [0, -1, 1e12, 1234567890123, Date.UTC(9999, 11, 31, 23, 59,
+                                                          59, 999)]) {
+  const d = new Date(time);
+  assertEquals(time, Date.parse(d.toISOString()));
+}
+
+assertEquals(Date.UTC(2024, 1, 29, 12, 34, 56, 789),
+             Date.parse('2024-02-29T12:34:56.789Z'));
+assertEquals(Date.UTC(2000, 0, 2), Date.parse('2000-01-01T24:00:00.000Z'));
+
+// Invalid components are still rejected.
+assertEquals(NaN, Date.parse('2024-13-01T00:00:00.000Z'));
+assertEquals(NaN, Date.parse('2024-00-01T00:00:00.000Z'));
+assertEquals(NaN, Date.parse('2024-01-32T00:00:00.000Z'));
+assertEquals(NaN, Date.parse('2024-01-01T25:00:00.000Z'));
+assertEquals(NaN, Date.parse('2024-01-01T00:60:00.000Z'));
+assertEquals(NaN, Date.parse('2024-01-01T00:00:60.000Z'));
+assertEquals(NaN, Date.parse('2024-01-01T24:00:00.001Z'));
@@ -0,0 +1,28 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --discard-trimmed-large-object-tails
+
+// Shrinking large arrays discards the unused tail of their backing store
+// right away; the remaining elements must stay intact, also when the array
+// grows again afterwards.
+function check(array, length, value) {
+  assertEquals(length, array.length);
+  for (let i = 0; i < length; i += 997) assertEquals(value(i), array[i]);
+  assertEquals(value(length - 1), array[length - 1]);
+}
+
+const doubles = new Array(1 << 20).fill(0.5).map((_, i) => i + 0.5);
+const objects = new Array(1 << 20).fill(0).map((_, i) => ({i}));
+for (let length = 1 << 19; length >= 16; length >>= 3) {
+  doubles.length = length;
+  objects.length = length;
+  check(doubles, length, i => i + 0.5);
+  assertEquals(length - 1, objects[length - 1].i);
+}
+for (let i = 16; i < 1 << 18; i++) doubles.push(i + 0.5);
+check(doubles, 1 << 18, i => i + 0.5);
+gc();
+check(doubles, 1 << 18, i => i + 0.5);
+assertEquals(15, objects[15].i);
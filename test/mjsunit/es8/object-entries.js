@@ -409,3 +409,37 @@ function TestElementKinds(withWarmup) {
 
 TestElementKinds();
 TestElementKinds(true);
+
+function TestDictionaryMode() {
+  var object = {a: 1, b: 2, c: 3, 0: "x"};
+  delete object.b;
+  assertFalse(%HasFastProperties(object));
+  Object.defineProperty(object, "hidden", {value: 4, enumerable: false});
+  Object.defineProperty(object, "getter", {
+    get() { delete this.last; return 5; },
+    enumerable: true,
+    configurable: true
+  });
+  object.last = 6;
+  assertEquals([["0", "x"], ["a", 1], ["c", 3], ["getter", 5]],
+               Object.entries(object));
+  assertEquals(["x", 1, 3, 5], Object.values(object));
+}
+TestDictionaryMode();
+
+function TestTypedArray() {
+  var rab = new ArrayBuffer(4, {maxByteLength: 8});
+  var ta = new Uint8Array(rab);
+  ta.set([1, 2, 3, 4]);
+  Object.defineProperty(ta, "hidden", {value: 5, enumerable: false});
+  // Named keys come after the indices, so shrinking the buffer here doesn't
+  // affect the current call, only the next one.
+  Object.defineProperty(ta, "shrink", {
+    get() { rab.resize(2); return "x"; },
+    enumerable: true
+  });
+  assertEquals([["0", 1], ["1", 2], ["2", 3], ["3", 4], ["shrink", "x"]],
+               Object.entries(ta));
+  assertEquals([1, 2, "x"], Object.values(ta));
+}
+TestTypedArray();
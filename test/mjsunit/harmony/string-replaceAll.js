@@ -107,3 +107,19 @@ assertEquals('b', 'abcdefghijklmndef'.replaceAll(
 
 assertEquals('aaaaaaaaaaaaaaaaaa', 'aaaaaaaaaaaaaaaaaa'.replaceAll(
     %ConstructConsString('abcdefghijklmn', 'def'), 'b'));
+
+{
+  // String search values with replacements that need no substitution are
+  // replaced in a single pass.
+  assertEquals('a b c', 'a\tb\tc'.replaceAll('\t', ' '));
+  assertEquals('abc', 'a, b, c'.replaceAll(', ', ''));
+  assertEquals('', ', , '.replaceAll(', ', ''));
+  assertEquals('xyz', 'xyz'.replaceAll('q', 'r'));
+  assertEquals('ĀxĀ', 'axa'.replaceAll('a', 'Ā'));
+  assertEquals('bxb', 'ĀxĀ'.replaceAll('Ā', 'b'));
+  assertEquals('1--2--3', '1.2.3'.replaceAll('.', '--'));
+  assertEquals('aaaa', 'abababab'.replaceAll('bab', 'a').replaceAll('ab', 'a'));
+  const long = 'ab'.repeat(1000);
+  assertEquals('cb'.repeat(1000), long.replaceAll('a', 'c'));
+  assertEquals('ab'.repeat(1000), long.replaceAll('x', 'y'));
+}
@@ -0,0 +1,43 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-sparkplug --no-maglev --no-turbofan
+
+// Comparisons in a test context dispatch directly to the following
+// JumpIfTrue/JumpIfFalse. Check both outcomes for each comparison.
+function compare(a, b) {
+  const result = [];
+  if (a == b) result.push('==');
+  if (a === b) result.push('===');
+  if (a < b) result.push('<');
+  if (a > b) result.push('>');
+  if (a <= b) result.push('<=');
+  if (a >= b) result.push('>=');
+  if (!(a === b)) result.push('!==');
+  return result.join(' ');
+}
+
+for (let i = 0; i < 3; i++) {
+  assertEquals('== === <= >=', compare(1, 1));
+  assertEquals('< <= !==', compare(1, 2));
+  assertEquals('> >= !==', compare(2, 1));
+  assertEquals('== <= >= !==', compare(1, '1'));
+  assertEquals('!==', compare(NaN, NaN));
+  assertEquals('== === <= >=', compare('a', 'a'));
+}
+
+function count(n) {
+  let i = 0;
+  while (i < n) i++;
+  do { i--; } while (i > 0);
+  return i;
+}
+assertEquals(0, count(10));
+
+function refEqual(x) {
+  return typeof x === 'number' ? 1 : x === null ? 2 : 3;
+}
+assertEquals(1, refEqual(1));
+assertEquals(2, refEqual(null));
+assertEquals(3, refEqual({}));
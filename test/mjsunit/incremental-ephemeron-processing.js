@@ -0,0 +1,32 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --incremental-ephemeron-processing --stress-incremental-marking
+// Flags: --expose-gc
+
+// A chain of ephemerons where each value is the key of the next entry, so that
+// every key only becomes reachable once the previous value was marked.
+const kLength = 1000;
+const map = new WeakMap();
+const head = {};
+let key = head;
+for (let i = 0; i < kLength; i++) {
+  const value = {index: i};
+  map.set(key, value);
+  key = value;
+}
+
+for (let round = 0; round < 3; round++) {
+  // Allocate to give incremental marking steps a chance to run.
+  let garbage = [];
+  for (let i = 0; i < 10000; i++) garbage.push({i});
+  garbage = null;
+  gc();
+}
+
+let current = head;
+for (let i = 0; i < kLength; i++) {
+  current = map.get(current);
+  assertEquals(i, current.index);
+}
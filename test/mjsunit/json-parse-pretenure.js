@@ -0,0 +1,18 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --json-parse-pretenure-threshold=64
+
+const source = JSON.stringify({
+  name: 'x'.repeat(20) + 'Ā',
+  values: [1, 2.5, 'str', {nested: [1.5, 2.5]}],
+  number: 1.5,
+  padding: 'y'.repeat(64),
+});
+const large = JSON.parse(source);
+assertEquals(source, JSON.stringify(large));
+assertFalse(%InYoungGeneration(large));
+assertFalse(%InYoungGeneration(large.values));
+assertFalse(%InYoungGeneration(large.values[3]));
+assertFalse(%InYoungGeneration(large.name));
@@ -0,0 +1,25 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the block-wise scanning of strings and whitespace with special
+// characters at every position relative to a block boundary.
+for (let i = 0; i < 40; i++) {
+  const prefix = 'x'.repeat(i);
+  assertEquals(prefix, JSON.parse(`"${prefix}"`));
+  assertEquals(prefix + '"' + prefix,
+               JSON.parse(`"${prefix}\\"${prefix}"`));
+  assertEquals(prefix + '\n' + prefix,
+               JSON.parse(`"${prefix}\\n${prefix}"`));
+  assertEquals(prefix + 'é' + prefix,
+               JSON.parse(`"${prefix}é${prefix}"`));
+  assertEquals(prefix + 'Ā' + prefix,
+               JSON.parse(`"${prefix}\\u0100${prefix}"`));
+  assertThrows(() => JSON.parse(`"${prefix}\n${prefix}"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+
+  const ws = ' \t\r\n'.repeat(i).slice(0, i);
+  assertEquals({a: [1, 2]}, JSON.parse(`${ws}{${ws}"a"${ws}:${ws}[${ws}1${
+                                ws},${ws}2${ws}]${ws}}${ws}`));
+  assertThrows(() => JSON.parse(`${ws}{${ws}x`), SyntaxError);
+}
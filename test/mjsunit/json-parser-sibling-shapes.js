@@ -0,0 +1,45 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function TestBrieflyDivergingShapes() {
+  const records = [
+    {a: 1, b: 'x', c: 1.5},
+    {a: 2, b: 'y', c: 2.5},
+    {z: true},
+    {a: 3, b: 'z', c: 3.5},
+    {q: null, r: [1]},
+    {z: false},
+    {a: 4, b: 'w', c: 4.5},
+    { "a" : 5 , "b" : "v", "c": 5.5 },
+    7,
+    {a: 6, b: 'u', c: 6.5},
+  ];
+  const parsed = JSON.parse(JSON.stringify(records));
+  assertEquals(records, parsed);
+  assertTrue(%HaveSameMap(parsed[0], parsed[3]));
+  assertTrue(%HaveSameMap(parsed[0], parsed[6]));
+  assertTrue(%HaveSameMap(parsed[0], parsed[9]));
+  assertTrue(%HaveSameMap(parsed[2], parsed[5]));
+})();
+
+(function TestPrefixKeys() {
+  // The first key of one shape is a prefix of the other.
+  const parsed = JSON.parse(
+      '[{"ab":1,"c":2},{"a":1,"c":2},{"ab":3,"c":4},{"a":5}]');
+  assertEquals([{ab: 1, c: 2}, {a: 1, c: 2}, {ab: 3, c: 4}, {a: 5}], parsed);
+  assertTrue(%HaveSameMap(parsed[0], parsed[2]));
+})();
+
+(function TestManyShapes() {
+  const records = [];
+  for (let i = 0; i < 100; i++) {
+    const o = {};
+    o['k' + (i % 7)] = i;
+    o.v = i;
+    records.push(o);
+  }
+  assertEquals(records, JSON.parse(JSON.stringify(records)));
+})();
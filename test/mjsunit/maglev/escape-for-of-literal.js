@@ -0,0 +1,43 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+// `for-of` over an array literal is reduced inside the loop, so the iterator
+// and its result objects only need to be materialized on deopt.
+function sum(a, b, c) {
+  let result = 0;
+  for (const x of [a, b, c]) {
+    result += x;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum(1, 2, 3));
+assertEquals(6, sum(1, 2, 3));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum(1, 2, 3));
+assertEquals(15, sum(4, 5, 6));
+// Deopts inside the loop body and materializes the iterator.
+assertEquals('0123', sum('1', 2, 3));
+assertEquals(6, sum(1, 2, 3));
+
+// The iterated array changes its elements kind inside the loop.
+function grow() {
+  const array = [1, 2, 3];
+  let result = 0;
+  for (const x of array) {
+    result += x;
+    if (array.length < 5) array.push(0.5);
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(grow);
+assertEquals(7, grow());
+assertEquals(7, grow());
+%OptimizeMaglevOnNextCall(grow);
+assertEquals(7, grow());
+assertEquals(7, grow());
@@ -0,0 +1,40 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-licm
+// Flags: --no-maglev-loop-peeling --no-always-turbofan --no-turbofan
+
+// LICM only looks at the loop header block. In a do-while loop the body is
+// part of the header, so the bounds check of the constant index into the loop
+// invariant array is a hoisting candidate.
+function sumFirst(a, n) {
+  let sum = 0;
+  let i = 0;
+  do {
+    sum += a[0];
+  } while (++i < n);
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sumFirst);
+assertEquals(30, sumFirst([3, 4], 10));
+assertEquals(30, sumFirst([3, 4], 10));
+%OptimizeMaglevOnNextCall(sumFirst);
+assertEquals(30, sumFirst([3, 4], 10));
+assertTrue(isMaglevved(sumFirst));
+assertEquals(4, sumFirst([1], 4));
+assertTrue(isMaglevved(sumFirst));
+
+// The hoisted bounds check fails before the first iteration and deopts. The
+// result must still be correct.
+assertEquals(NaN, sumFirst([], 2));
+assertUnoptimized(sumFirst);
+
+// After the deopt the check is not hoisted again, and the out of bounds
+// feedback makes the load handle the empty array without deopting.
+%OptimizeMaglevOnNextCall(sumFirst);
+assertEquals(6, sumFirst([2], 3));
+assertTrue(isMaglevved(sumFirst));
+assertEquals(NaN, sumFirst([], 2));
+assertTrue(isMaglevved(sumFirst));
@@ -0,0 +1,28 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-osr --use-osr --no-stress-opt
+// Flags: --concurrent-osr --concurrent-recompilation --efficiency-mode
+// Flags: --no-efficiency-mode-synchronous-maglev --no-baseline-batch-compilation
+
+// Even in efficiency mode, OSR into Maglev can be compiled concurrently. The
+// loop keeps running in the unoptimized tiers until the code is ready and is
+// entered at a later loop iteration.
+let keep_going = 10000000;  // A counter to avoid test hangs on failure.
+
+function f() {
+  let reached_maglev = false;
+  while (!reached_maglev && --keep_going) {
+    reached_maglev = topFrameIsMaglevved(%GetOptimizationStatus(f));
+  }
+}
+
+function g() {
+  if (!%IsMaglevEnabled()) return;
+  f();
+  assertTrue(keep_going > 0);
+}
+%NeverOptimizeFunction(g);
+
+g();
@@ -0,0 +1,40 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// The experimental engine skips input positions at which the regexp body
+// cannot start matching. Check match positions and captures around skipped
+// stretches of input.
+function Test(regexp, subject, expected) {
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(regexp));
+  const result = regexp.exec(subject);
+  if (expected === null) {
+    assertNull(result);
+  } else {
+    assertArrayEquals(expected, [...result]);
+  }
+}
+
+const filler = 'abcdefghij'.repeat(10);
+
+Test(/@x/, filler + '@x', ['@x']);
+Test(/@x/, filler + '@' + filler + '@x', ['@x']);
+Test(/@x/, filler, null);
+Test(/[A-Z]+@/, filler + 'A' + filler + 'XYZ@' + filler, ['XYZ@']);
+Test(/(\d+)kb|(MB)/, filler + '42kb', ['42kb', '42', undefined]);
+Test(/(\d+)kb|(MB)/, filler + 'MB', ['MB', undefined, 'MB']);
+Test(/(?:x|y)(z)/, filler + 'xyz', ['yz', 'z']);
+Test(/쁰d/, filler + '쁰d', ['쁰d']);
+
+// Bodies that may match the empty string or start with an assertion are not
+// filtered, but must still find the leftmost match.
+Test(/x*/, filler + 'x', ['']);
+Test(/\bj/, filler + ' j', ['j']);
+Test(/j$/, filler + 'j', ['j']);
+
+// Global matching resumes the skipping at lastIndex.
+const global = /[0-9]/g;
+assertEquals(['1', '5', '9'], (filler + '1' + filler + '5' + filler + '9')
+                                  .match(global));
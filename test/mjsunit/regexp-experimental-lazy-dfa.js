@@ -0,0 +1,43 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// Inputs without a match are rejected by the lazy DFA before the NFA runs.
+// Check that matches are still found and reported with correct captures.
+function Test(regexp, subject, expected) {
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(regexp));
+  const result = regexp.exec(subject);
+  if (expected === null) {
+    assertNull(result);
+  } else {
+    assertArrayEquals(expected, [...result]);
+  }
+}
+
+const filler = 'abcdefghij'.repeat(10);
+
+Test(/^[a-z]+$/, filler + '!', null);
+Test(/[a-z]+-[0-9]{3}/, filler, null);
+Test(/[a-z]+-[0-9]{3}/, filler + '-12', null);
+Test(/[a-z]+-([0-9]{3})/, filler + '-123', [filler + '-123', '123']);
+Test(/(?:a*)*b/, 'aaaa', null);
+Test(/(?:a*)*b/, 'aaab', ['aaab']);
+Test(/(a|ab)(c|bcd)(d*)/, 'abcd', ['abcd', 'a', 'bcd', '']);
+Test(/x{0,3}/, '', ['']);
+Test(/쁰+d/, filler + '쁰쁰', null);
+Test(/쁰+d/, filler + '쁰쁰d', ['쁰쁰d']);
+
+// Transitions are cached per character class, so two-byte subjects with many
+// distinct characters reuse the same few transitions.
+let wide = '';
+for (let i = 0x100; i < 0x2000; i++) wide += String.fromCharCode(i);
+Test(/[Ā-￿]{3}x/, wide, null);
+Test(/[Ā-￿]{3}x/, wide + 'x', [wide.slice(-3) + 'x']);
+Test(/[Ā-ϿЀ-ӿ]+y/, wide, null);
+Test(/[Ā-ϿЀ-ӿ]+y/, 'ϾЁy', ['ϾЁy']);
+
+// Global matching rejects the remainder of the input after the last match.
+assertEquals(['ab1', 'cd2'], 'ab1 cd2 efg'.match(/[a-z]+\d/g));
+assertEquals('X X efg', 'ab1 cd2 efg'.replace(/[a-z]+\d/g, 'X'));
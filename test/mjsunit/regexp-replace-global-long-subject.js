@@ -0,0 +1,29 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global string replacements in long subjects are performed in the runtime.
+// Check that the result and the legacy RegExp statics match the short-subject
+// path.
+function Check(length) {
+  const subject = 'ab1 cd22 '.repeat(length / 9 + 1).slice(0, length);
+  const expected = subject.split(/[a-z]+\d+/).join('<x>');
+  const last = subject.match(/[a-z]+\d+/g).pop();
+  const last_digits = last.match(/\d+/)[0];
+  const re = /[a-z]+(\d+)/g;
+  re.lastIndex = 7;
+  const result = subject.replace(re, '<x>');
+  assertEquals(last, RegExp.lastMatch);
+  assertEquals(last_digits, RegExp.$1);
+  assertEquals(0, re.lastIndex);
+  assertEquals(expected, result);
+
+  assertEquals(subject.split(/\d/).join(''), subject.replace(/\d/g, ''));
+  assertEquals(subject, subject.replace(/xyz/g, '-'));
+  assertEquals(subject.split('ab').join('ሴ'),
+               subject.replace(/ab/g, 'ሴ'));
+}
+
+Check(100);
+Check(0x1000);
+Check(0x10000);
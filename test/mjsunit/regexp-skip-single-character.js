@@ -0,0 +1,22 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up-ticks=0
+
+// Patterns whose Boyer-Moore lookahead reduces to a single character are
+// skipped over with the table scan. Place the match at every offset relative
+// to a vector boundary.
+for (let i = 0; i < 48; i++) {
+  const prefix = 'a'.repeat(i);
+  assertEquals(i, (prefix + 'xyz@b').search(/xyz@/));
+  assertEquals(i, (prefix + '@b').search(/@b/));
+  assertEquals(0, (prefix + 'foo@bar').search(/[a-z]+@/));
+  assertEquals(i, (prefix.toUpperCase() + 'foo@bar').search(/[a-z]+@/));
+  assertEquals(-1, prefix.search(/xyz@/));
+  assertEquals(i, (prefix + 'éxyz').search(/éxyz/));
+  assertEquals(i, (prefix + 'Āxyz').search(/Āxyz/));
+  const m = /(\d+)kb/.exec(prefix + '123kb');
+  assertEquals('123', m[1]);
+  assertEquals(i, m.index);
+}
@@ -0,0 +1,41 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=100
+// Flags: --regexp-tier-up-backtracks=1000
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+// A regexp that backtracks a lot in the interpreter tiers up on the next
+// execution, even though it has not used up its execution ticks.
+let re = /^(a+)+$/;
+const subject = 'a'.repeat(16) + 'b';
+assertFalse(re.test(subject));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertFalse(re.test(subject));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
+assertFalse(%RegexpHasBytecode(re, kLatin1));
+
+// Cheap executions stay in the interpreter.
+re = /^a+b$/;
+assertTrue(re.test(subject));
+assertTrue(re.test(subject));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertFalse(%RegexpHasNativeCode(re, kLatin1));
+
+// Long subjects tier up eagerly for small patterns...
+const long_subject = 'a'.repeat(1500);
+re = /[xy]z/;
+assertFalse(re.test(long_subject));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
+
+// ...but large patterns need proportionally longer subjects.
+re = new RegExp('[xy]'.repeat(70));
+assertFalse(re.test(long_subject));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertFalse(%RegexpHasNativeCode(re, kLatin1));
+assertFalse(re.test(long_subject + long_subject + long_subject));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
@@ -0,0 +1,32 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --scavenger-string-deduplication --expose-gc
+
+// Strings with equal contents that are promoted by the same scavenge may be
+// merged. Make sure they keep their contents and stay usable as keys.
+function makeStrings(count) {
+  const strings = [];
+  const hashed = new Set();
+  for (let i = 0; i < count; i++) {
+    const s = 'key_' + (i % 16) + '_' + 'x'.repeat(i % 3);
+    // Using the string as a Set key computes its hash without internalizing
+    // it, which makes it a candidate for deduplication.
+    hashed.add(s);
+    strings.push(s);
+  }
+  return strings;
+}
+
+const strings = makeStrings(1000);
+gc({type: 'minor'});
+gc({type: 'minor'});
+
+const map = new Map();
+for (let i = 0; i < strings.length; i++) {
+  const expected = 'key_' + (i % 16) + '_' + 'x'.repeat(i % 3);
+  assertEquals(expected, strings[i]);
+  map.set(strings[i], (map.get(strings[i]) ?? 0) + 1);
+}
+assertEquals(48, map.size);
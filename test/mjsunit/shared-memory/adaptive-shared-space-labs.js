@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct --adaptive-shared-space-labs
+// Flags: --expose-gc
+
+"use strict";
+
+if (this.Worker) {
+
+(function TestConcurrentSharedStructAllocation() {
+  const kCount = 20000;
+  let workerScript =
+      `onmessage = function({data:Struct}) {
+         let last;
+         for (let i = 0; i < ${kCount}; i++) {
+           last = new Struct();
+           last.value = i;
+         }
+         postMessage(last);
+       };`;
+
+  const Struct = new SharedStructType(['value']);
+  const workers = [];
+  for (let i = 0; i < 4; i++) {
+    const worker = new Worker(workerScript, {type: 'string'});
+    worker.postMessage(Struct);
+    workers.push(worker);
+  }
+  const structs = [];
+  for (let i = 0; i < kCount; i++) {
+    const struct = new Struct();
+    struct.value = i;
+    if (i % 100 == 0) structs.push(struct);
+  }
+  for (const worker of workers) {
+    assertEquals(kCount - 1, worker.getMessage().value);
+    worker.terminate();
+  }
+  gc();
+  for (let i = 0; i < structs.length; i++) {
+    assertEquals(i * 100, structs[i].value);
+  }
+})();
+
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct --parallel-major-sweeping
+// Flags: --expose-gc
+
+"use strict";
+
+(function TestSweepLargeSharedSpace() {
+  const Struct = new SharedStructType(['value']);
+  const live = [];
+  for (let round = 0; round < 3; round++) {
+    for (let i = 0; i < 50000; i++) {
+      const struct = new Struct();
+      struct.value = i;
+      if (i % 1000 == 0) live.push(struct);
+    }
+    // Start sweeping and finalize it right away from the next GC.
+    gc();
+  }
+  gc();
+  for (let i = 0; i < live.length; i++) {
+    assertEquals((i % 50) * 1000, live[i].value);
+  }
+})();
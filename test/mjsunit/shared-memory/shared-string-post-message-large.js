@@ -0,0 +1,32 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --allow-natives-syntax
+
+if (this.Worker) {
+
+(function TestLargeStringPostMessage() {
+  function workerCode() {
+    onmessage = function({data:str}) {
+      postMessage(%IsSharedString(str) ? str : 'not shared');
+    };
+  }
+
+  // Large strings are moved into the shared heap instead of being copied into
+  // the message.
+  let worker = new Worker(workerCode, { type: 'function' });
+  let payload = %FlattenString('a'.repeat(1024 * 64) + 'b');
+  worker.postMessage(payload);
+  let received = worker.getMessage();
+  assertTrue(%IsSharedString(received));
+  assertEquals(payload, received);
+
+  // Small strings are still copied.
+  worker.postMessage('small');
+  assertEquals('not shared', worker.getMessage());
+
+  worker.terminate();
+})();
+
+}
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct --allow-natives-syntax
+// Flags: --maglev --no-stress-opt --verify-heap
+// Flags: --no-always-turbofan --no-turbofan
+
+"use strict";
+
+let Point = new SharedStructType(['x', 'y']);
+
+// Stores of values known to be Smis are inlined, other values still go
+// through the generic path which shares them.
+function store(p, s) {
+  p.x = 42;
+  p.y = s;
+}
+
+let p = new Point();
+%PrepareFunctionForOptimization(store);
+store(p, 'a');
+store(p, 'b');
+%OptimizeMaglevOnNextCall(store);
+store(p, 'c');
+assertTrue(isMaglevved(store));
+assertEquals(42, p.x);
+assertEquals('c', p.y);
+
+// Further shareable stores keep running the optimized code.
+store(p, 'd');
+assertTrue(isMaglevved(store));
+assertEquals('d', p.y);
+
+// Non-shareable values still throw.
+assertThrows(() => store(p, {}));
+assertEquals(42, p.x);
@@ -0,0 +1,52 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched a block of characters at a time. Check matches
+// at every position relative to a block boundary, near the end of the
+// subject, and with partial matches of the first and last character.
+function naiveIndexOf(subject, pattern, from) {
+  outer: for (let i = from; i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[j + i] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern) {
+  for (let from = 0; from < 3; from++) {
+    assertEquals(naiveIndexOf(subject, pattern, from),
+                 subject.indexOf(pattern, from), `${subject} ${pattern}`);
+  }
+  assertEquals(naiveIndexOf(subject, pattern, 0) !== -1,
+               subject.includes(pattern));
+}
+
+const patterns = ['ab', 'abc', 'aXb', 'abcd', 'abcab', 'aaaaab', 'Āb',
+                  'aĀ'];
+for (const pattern of patterns) {
+  for (let len = 0; len < 70; len++) {
+    const filler = 'a'.repeat(len);
+    // Candidates where only the first and last characters match.
+    const decoy = pattern[0] + 'Z'.repeat(Math.max(0, pattern.length - 2)) +
+                  pattern[pattern.length - 1];
+    check(filler + pattern, pattern);
+    check(filler + decoy + filler + pattern + filler, pattern);
+    check(filler + decoy + filler, pattern);
+    // Same subjects as two-byte strings, searched for both one-byte and
+    // two-byte patterns.
+    check('\u0100' + filler + pattern, pattern);
+    check('\u0100' + filler + decoy + filler + pattern, pattern);
+    check('\u0100' + filler + decoy + filler, pattern);
+  }
+}
+
+// One-byte pattern in a two-byte subject.
+assertEquals(17, ('\u0100' + 'a'.repeat(16) + 'xyz').indexOf('xyz'));
+assertEquals(-1, ('\u0100' + 'a'.repeat(16) + 'xy').indexOf('xyz'));
+// Two-byte pattern in a two-byte subject.
+assertEquals(17, ('\u0100' + 'a'.repeat(16) + '\u0100b').indexOf('\u0100b'));
+assertEquals(0, ('\u0100b' + 'a'.repeat(16)).indexOf('\u0100b'));
+assertEquals(-1, ('\u0100' + 'a'.repeat(16) + '\u0101b').indexOf('\u0100b'));
@@ -0,0 +1,44 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turbolev
+
+const obj = {};
+const m = new Map([[1, 'a'], [-0, 'b'], ['str', 'c'], [obj, 'd'], [1.5, 'e']]);
+
+function has(m, k) {
+  return m.has(k);
+}
+
+function hasInt32(m, i) {
+  return m.has(i | 0);
+}
+
+function check() {
+  assertTrue(has(m, 1));
+  assertTrue(has(m, 0));
+  assertTrue(has(m, -0));
+  assertTrue(has(m, 'str'));
+  assertTrue(has(m, 'st' + 'r'));
+  assertTrue(has(m, obj));
+  assertTrue(has(m, 1.5));
+  assertFalse(has(m, 2));
+  assertFalse(has(m, 'x'));
+  assertFalse(has(m, {}));
+  assertFalse(has(m, undefined));
+
+  assertTrue(hasInt32(m, 1));
+  assertTrue(hasInt32(m, 0));
+  assertFalse(hasInt32(m, 2));
+  assertFalse(hasInt32(m, -1));
+}
+
+%PrepareFunctionForOptimization(has);
+%PrepareFunctionForOptimization(hasInt32);
+check();
+%OptimizeFunctionOnNextCall(has);
+%OptimizeFunctionOnNextCall(hasInt32);
+check();
+assertOptimized(has);
+assertOptimized(hasInt32);
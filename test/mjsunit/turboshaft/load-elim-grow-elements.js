@@ -0,0 +1,39 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --turboshaft-load-elimination
+
+// Growing the elements of an array only invalidates its Elements field:
+// loads of other fields and of the old backing store stay valid, while the
+// elements themselves have to be reloaded.
+function push(o, a, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    a.push(o.x + i);
+    sum += o.y + a[i] + a.length;
+  }
+  return sum;
+}
+
+function pushDouble(o, a, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    a.push(o.x + i + 0.5);
+    sum += o.y + a[i] + a.length;
+  }
+  return sum;
+}
+
+for (let f of [push, pushDouble]) {
+  %PrepareFunctionForOptimization(f);
+  const expected = f({x: 1, y: 2}, [], 100);
+  f({x: 1, y: 2}, [], 3);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f({x: 1, y: 2}, [], 100));
+  const a = [];
+  f({x: 1, y: 2}, a, 100);
+  assertEquals(100, a.length);
+  assertEquals(f === push ? 100 : 100.5, a[99]);
+}
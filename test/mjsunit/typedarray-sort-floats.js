@@ -0,0 +1,45 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --js-float16array
+
+// The default sort of float typed arrays orders -0 before +0 and NaNs last.
+function referenceCompare(a, b) {
+  if (Number.isNaN(a)) return Number.isNaN(b) ? 0 : 1;
+  if (Number.isNaN(b)) return -1;
+  if (a === 0 && b === 0) return Object.is(a, -0) ? (Object.is(b, -0) ? 0 : -1)
+                                                  : (Object.is(b, -0) ? 1 : 0);
+  return a < b ? -1 : a > b ? 1 : 0;
+}
+
+const special = [NaN, -0, 0, Infinity, -Infinity, 5e-324, -5e-324, 1.5, -1.5,
+                 65504, -65504, 2 ** -24, -(2 ** -24)];
+
+function test(constructor, buffer_constructor) {
+  const length = 1000;
+  const buffer =
+      new buffer_constructor(length * constructor.BYTES_PER_ELEMENT);
+  const array = new constructor(buffer);
+  for (let i = 0; i < length; i++) {
+    array[i] = i % 3 == 0 ? special[i % special.length]
+                          : (i * 7919 % 1013) - 500.25;
+  }
+  const expected = Array.from(array).sort(referenceCompare);
+  array.sort();
+  for (let i = 0; i < length; i++) {
+    assertTrue(Object.is(expected[i], array[i]), `${constructor.name} @ ${i}`);
+  }
+}
+
+for (const constructor of [Float16Array, Float32Array, Float64Array]) {
+  test(constructor, ArrayBuffer);
+  test(constructor, SharedArrayBuffer);
+}
+
+// Views starting at a non-zero byte offset into their buffer.
+const offset_view = new Float64Array(new ArrayBuffer(8 * 9), 8, 8);
+offset_view.set([NaN, 2, -0, 0, -Infinity, 1, NaN, -1]);
+offset_view.sort();
+assertEquals([-Infinity, -1, -0, 0, 1, 2, NaN, NaN], Array.from(offset_view));
+assertTrue(Object.is(-0, offset_view[2]));
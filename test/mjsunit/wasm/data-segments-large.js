@@ -0,0 +1,41 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Data segments of several MB are copied in chunks on worker threads. Check
+// that the content is correct across chunk boundaries and that a later
+// overlapping segment still wins.
+const kPages = 160;
+const kSize = 9 * 1024 * 1024 + 123;
+const kOffset = 17;
+
+const data = new Uint8Array(kSize);
+for (let i = 0; i < kSize; i++) data[i] = (i * 7) & 0xff;
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(kPages, kPages);
+builder.exportMemoryAs("memory");
+builder.addActiveDataSegment(0, wasmI32Const(kOffset), data);
+builder.addActiveDataSegment(
+    0, wasmI32Const(kOffset + 1024 * 1024), [1, 2, 3]);
+const instance = builder.instantiate();
+
+const memory = new Uint8Array(instance.exports.memory.buffer);
+assertEquals(0, memory[kOffset - 1]);
+assertEquals(0, memory[kOffset + kSize]);
+for (let i = 0; i < kSize; i += 4093) {
+  assertEquals((i * 7) & 0xff, memory[kOffset + i]);
+}
+for (let chunk = 1; chunk <= 9; chunk++) {
+  const i = chunk * 1024 * 1024;
+  for (let j = i - 2; j < i + 2; j++) {
+    if (j >= 1024 * 1024 && j < 1024 * 1024 + 3) continue;
+    assertEquals((j * 7) & 0xff, memory[kOffset + j]);
+  }
+}
+assertEquals([1, 2, 3],
+             Array.from(memory.subarray(kOffset + 1024 * 1024,
+                                        kOffset + 1024 * 1024 + 3)));
+assertEquals((kSize - 1) * 7 & 0xff, memory[kOffset + kSize - 1]);
@@ -0,0 +1,68 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --experimental-wasm-closed-world
+// Flags: --no-wasm-lazy-compilation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const base = builder.addStruct([makeField(kWasmI32, true)]);
+const sub = builder.addStruct(
+    [makeField(kWasmI32, true), makeField(kWasmI32, true)], base);
+const other = builder.addStruct([makeField(kWasmF64, true)]);
+// Canonically equivalent to {base}, so objects of {sub} are subtypes of it
+// even though no type in the module declares it as its supertype.
+const duplicate = builder.addStruct([makeField(kWasmI32, true)]);
+
+builder.addFunction('makeBase', makeSig([], [kWasmAnyRef]))
+    .addBody([kExprI32Const, 1, kGCPrefix, kExprStructNew, base])
+    .exportFunc();
+builder.addFunction('makeSub', makeSig([], [kWasmAnyRef]))
+    .addBody([
+      kExprI32Const, 2, kExprI32Const, 3, kGCPrefix, kExprStructNew, sub
+    ])
+    .exportFunc();
+builder.addFunction('makeOther', makeSig([], [kWasmAnyRef]))
+    .addBody([
+      ...wasmF64Const(4), kGCPrefix, kExprStructNew, other
+    ])
+    .exportFunc();
+
+function addCast(name, type) {
+  builder.addFunction(name, makeSig([kWasmAnyRef], [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 0, kGCPrefix, kExprRefCast, type,
+        kGCPrefix, kExprStructGet, type, 0
+      ])
+      .exportFunc();
+}
+addCast('castBase', base);
+addCast('castSub', sub);
+addCast('castDuplicate', duplicate);
+
+const instance = builder.instantiate();
+const exports = instance.exports;
+
+function check() {
+  const b = exports.makeBase();
+  const s = exports.makeSub();
+  const o = exports.makeOther();
+  assertEquals(1, exports.castBase(b));
+  assertEquals(2, exports.castBase(s));
+  assertTraps(kTrapIllegalCast, () => exports.castBase(o));
+  assertEquals(2, exports.castSub(s));
+  assertTraps(kTrapIllegalCast, () => exports.castSub(b));
+  assertTraps(kTrapIllegalCast, () => exports.castSub(o));
+  assertEquals(1, exports.castDuplicate(b));
+  assertEquals(2, exports.castDuplicate(s));
+  assertTraps(kTrapIllegalCast, () => exports.castDuplicate(o));
+  assertTraps(kTrapIllegalCast, () => exports.castSub(null));
+}
+
+check();
+for (const name of ['castBase', 'castSub', 'castDuplicate']) {
+  %WasmTierUpFunction(exports[name]);
+}
+check();
@@ -0,0 +1,64 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --liftoff-inline-allocation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const list = builder.addStruct(
+    [makeField(kWasmI32, true), makeField(wasmRefNullType(0), true)]);
+const bytes = builder.addArray(kWasmI8, true);
+
+// Builds a linked list of {n} structs, surviving allocation area refills and
+// garbage collections, and sums up its values.
+builder.addFunction('sum', makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(wasmRefNullType(list), 1)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 0, kExprLocalGet, 1,
+        kGCPrefix, kExprStructNew, list,
+        kExprLocalSet, 1,
+        kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprBrOnNull, 1,
+          kGCPrefix, kExprStructGet, list, 0,
+          kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 1, kExprRefAsNonNull,
+          kGCPrefix, kExprStructGet, list, 1,
+          kExprLocalSet, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 2
+    ])
+    .exportFunc();
+
+builder.addFunction('arrays', makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(wasmRefNullType(bytes), 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprI32Const, 1, kExprI32Const, 2, kExprLocalGet, 0,
+        kGCPrefix, kExprArrayNewFixed, bytes, 3,
+        kExprLocalSet, 1,
+        kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 1, kExprI32Const, 2, kGCPrefix, kExprArrayGetU, bytes,
+      kExprLocalGet, 1, kGCPrefix, kExprArrayLen,
+      kExprI32Add
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+assertTrue(%IsLiftoffFunction(instance.exports.sum));
+assertEquals(1, instance.exports.sum(1));
+assertEquals(1250025000, instance.exports.sum(50000));
+assertEquals(4, instance.exports.arrays(1));
+assertEquals(4, instance.exports.arrays(100000));
@@ -0,0 +1,60 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --liftoff-keep-loop-invariant-locals
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+
+// Local 0 is not assigned in the loop and can stay in its register.
+builder.addFunction('mul', kSig_i_ii)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 2, kExprLocalGet, 0, kExprI32Add, kExprLocalSet, 2,
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 1,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 2
+    ])
+    .exportFunc();
+
+// The inner loop counter is assigned in the outer loop and must not be kept
+// in a register across the outer back edge.
+builder.addFunction('nested', kSig_i_ii)
+    .addLocals(kWasmI32, 2)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 0, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 3, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 3,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 1,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 2
+    ])
+    .exportFunc();
+
+// The register of local 0 is shared with a value on the stack below the loop.
+builder.addFunction('shared', kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 1,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 0, kExprI32Add
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+assertTrue(%IsLiftoffFunction(instance.exports.mul));
+assertEquals(15, instance.exports.mul(3, 5));
+assertEquals(24, instance.exports.nested(4, 6));
+assertEquals(14, instance.exports.shared(7, 3));
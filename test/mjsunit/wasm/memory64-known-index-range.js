@@ -0,0 +1,58 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff --no-wasm-lazy-compilation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Memory64 accesses whose index is known to be small do not need the explicit
+// check against the guard region; out-of-bounds accesses must still trap.
+const builder = new WasmModuleBuilder();
+builder.addMemory64(1, 1);
+builder.exportMemoryAs('memory');
+
+builder.addFunction('load_extended', makeSig([kWasmI32], [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0, kExprI64UConvertI32,
+      kExprI32LoadMem, 0, 0
+    ])
+    .exportFunc();
+
+builder.addFunction('load_masked', makeSig([kWasmI64], [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0, ...wasmI64Const(0xffffff), kExprI64And,
+      kExprI32LoadMem, 0, 0
+    ])
+    .exportFunc();
+
+builder.addFunction('load_shifted', makeSig([kWasmI64], [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0, ...wasmI64Const(40), kExprI64ShrU,
+      kExprI32LoadMem, 0, 0
+    ])
+    .exportFunc();
+
+builder.addFunction('load_unknown', makeSig([kWasmI64], [kWasmI32]))
+    .addBody([kExprLocalGet, 0, kExprI32LoadMem, 0, 0])
+    .exportFunc();
+
+const instance = builder.instantiate();
+const {memory, load_extended, load_masked, load_shifted, load_unknown} =
+    instance.exports;
+new Int32Array(memory.buffer)[1] = 42;
+
+assertEquals(42, load_extended(4));
+assertTraps(kTrapMemOutOfBounds, () => load_extended(kPageSize - 3));
+assertTraps(kTrapMemOutOfBounds, () => load_extended(-1));
+
+assertEquals(42, load_masked(4n));
+assertEquals(42, load_masked(0x7f000004n));
+assertTraps(kTrapMemOutOfBounds, () => load_masked(0xfffffcn));
+
+assertEquals(42, load_shifted(4n << 40n));
+assertTraps(kTrapMemOutOfBounds, () => load_shifted(-1n));
+
+assertEquals(42, load_unknown(4n));
+assertTraps(kTrapMemOutOfBounds, () => load_unknown(-1n));
+assertTraps(kTrapMemOutOfBounds, () => load_unknown(1n << 40n));
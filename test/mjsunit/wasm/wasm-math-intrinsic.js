@@ -192,7 +192,7 @@ function assertBinop(name, math_func, wasm_func) {
 (function TestF64() {
   let f64_intrinsics = [
     'acos', 'asin', 'atan', 'cos', 'sin', 'tan', 'exp', 'log', 'atan2', 'pow',
-    'sqrt',
+    'sqrt', 'abs', 'ceil', 'floor', 'trunc', 'min', 'max',
   ];
 
   for (let name of f64_intrinsics) {
@@ -76,6 +76,44 @@ TEST(OS, RemapPages) {
   }
 }
 
+#if V8_OS_LINUX
+TEST(OS, AdviseHugePages) {
+  const size_t huge_page_size = OS::kTransparentHugePageSize;
+  const size_t size = 2 * huge_page_size;
+  void* data = OS::Allocate(nullptr, size, OS::AllocatePageSize(),
+                            OS::MemoryPermission::kReadWrite);
+  ASSERT_TRUE(data);
+
+  // Ranges without a whole aligned huge page are rejected.
+  EXPECT_FALSE(OS::AdviseHugePages(data, OS::AllocatePageSize()));
+  // The advice may be rejected if the kernel lacks huge page support, but
+  // must not affect the contents of the memory either way.
+  memset(data, 0x42, size);
+  USE(OS::AdviseHugePages(data, size));
+  EXPECT_EQ(0x42, static_cast<uint8_t*>(data)[size - 1]);
+
+  OS::Free(data, size);
+}
+#endif  // V8_OS_LINUX
+
+TEST(OS, BindMemoryToNumaNode) {
+  if constexpr (OS::IsNumaBindingSupported()) {
+    const int node = OS::GetCurrentNumaNode();
+    if (node < 0) return;
+    const size_t size = OS::AllocatePageSize();
+    void* data = OS::Allocate(nullptr, size, OS::AllocatePageSize(),
+                              OS::MemoryPermission::kReadWrite);
+    ASSERT_TRUE(data);
+    memset(data, 0x42, size);
+    // Binding may be rejected (e.g. in sandboxes without mbind), but must not
+    // affect the contents of the memory either way.
+    USE(OS::BindMemoryToNumaNode(data, size, node));
+    EXPECT_EQ(0x42, static_cast<uint8_t*>(data)[size - 1]);
+    EXPECT_FALSE(OS::BindMemoryToNumaNode(data, size, -1));
+    OS::Free(data, size);
+  }
+}
+
 #ifdef V8_TARGET_OS_LINUX
 TEST(OS, ParseProcMaps) {
   // Truncated
@@ -5,6 +5,8 @@
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
@@ -17,6 +19,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -107,5 +110,61 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   i_isolate()->SetOptimizingCompileDispatcherForTesting(original);
 }
 
+TEST_F(OptimizingCompileDispatcherTest, InputQueueOrderedByPriority) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  OptimizingCompileInputQueue queue(8);
+
+  const int priorities[] = {0, 5, 1, 5, 0};
+  std::vector<BlockingCompilationJob*> jobs;
+  for (int priority : priorities) {
+    BlockingCompilationJob* job = new BlockingCompilationJob(i_isolate(), fun);
+    job->set_priority(priority);
+    jobs.push_back(job);
+    std::unique_ptr<TurbofanCompilationJob> compilation_job(job);
+    ASSERT_TRUE(queue.Enqueue(compilation_job));
+  }
+
+  // Higher priorities first, FIFO among equal priorities.
+  const size_t expected_order[] = {1, 3, 2, 0, 4};
+  for (size_t index : expected_order) {
+    OptimizingCompileTaskState task_state{nullptr, nullptr};
+    std::unique_ptr<TurbofanCompilationJob> job(queue.Dequeue(task_state));
+    EXPECT_EQ(jobs[index], job.get());
+  }
+  EXPECT_EQ(0u, queue.Length());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, PrioritizeKeepsInputQueueOrdered) {
+  FlagScope<bool> hotness_order(
+      &v8_flags.concurrent_recompilation_hotness_order, true);
+  OptimizingCompileInputQueue queue(8);
+
+  const int priorities[] = {5, 3, 3, 1};
+  std::vector<BlockingCompilationJob*> jobs;
+  for (size_t i = 0; i < arraysize(priorities); i++) {
+    std::string source = "(function f" + std::to_string(i) + "() {})";
+    Handle<JSFunction> fun = RunJS<JSFunction>(source.c_str());
+    BlockingCompilationJob* job = new BlockingCompilationJob(i_isolate(), fun);
+    job->set_priority(priorities[i]);
+    jobs.push_back(job);
+    std::unique_ptr<TurbofanCompilationJob> compilation_job(job);
+    ASSERT_TRUE(queue.Enqueue(compilation_job));
+  }
+
+  // The prioritized job goes first and gets the highest queued priority, so
+  // jobs enqueued later are still inserted at the right position.
+  queue.Prioritize(i_isolate(), *jobs[2]->compilation_info()->shared_info());
+  EXPECT_EQ(5, jobs[2]->priority());
+
+  const size_t expected_order[] = {2, 0, 1, 3};
+  for (size_t index : expected_order) {
+    OptimizingCompileTaskState task_state{nullptr, nullptr};
+    std::unique_ptr<TurbofanCompilationJob> job(queue.Dequeue(task_state));
+    EXPECT_EQ(jobs[index], job.get());
+  }
+  EXPECT_EQ(0u, queue.Length());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -20,6 +20,8 @@
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
+#include "src/zone/zone.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"  // For ManualGCScope.
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -749,6 +751,48 @@ TEST_F(CompilerTest, InvocationCount) {
   EXPECT_EQ(4, foo->feedback_vector()->invocation_count());
 }
 
+TEST_F(CompilerTest, ConcurrentOptimizationZoneBudget) {
+  if (!i_isolate()->use_optimizer() || !v8_flags.turbofan ||
+      !i_isolate()->concurrent_recompilation_enabled()) {
+    return;
+  }
+  FlagScope<bool> allow_natives_syntax(&v8_flags.allow_natives_syntax, true);
+  FlagScope<unsigned> zone_budget(
+      &v8_flags.concurrent_compilation_zone_budget_mb, 1);
+  v8::HandleScope scope(isolate());
+
+  constexpr int kOptimizedOrInProgress =
+      (1 << 3) /* kOptimized */ | (1 << 9) /* kOptimizingConcurrently */;
+  auto optimization_status = [&]() {
+    return RunJS("%GetOptimizationStatus(f)")
+        ->Int32Value(context())
+        .FromJust();
+  };
+
+  RunJS(
+      "function f(x) { return x * 2 + 1; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1);");
+  {
+    // Zone memory above the budget keeps new jobs from being started.
+    Zone zone(i_isolate()->allocator(), ZONE_NAME);
+    zone.AllocateArray<uint8_t>(2 * MB);
+    RunJS(
+        "%OptimizeFunctionOnNextCall(f, 'concurrent');"
+        "f(2);");
+    EXPECT_EQ(0, optimization_status() & kOptimizedOrInProgress);
+  }
+
+  // Once the memory has been released, a later request is compiled.
+  RunJS(
+      "%DisableOptimizationFinalization();"
+      "%OptimizeFunctionOnNextCall(f, 'concurrent');"
+      "f(3);"
+      "%FinalizeOptimization();");
+  DirectHandle<JSFunction> f = Cast<JSFunction>(GetGlobalProperty("f"));
+  EXPECT_TRUE(f->HasAttachedOptimizedCode(i_isolate()));
+}
+
 TEST_F(CompilerTest, ShallowEagerCompilation) {
   v8::HandleScope scope(isolate());
   v8::Local<v8::String> source = NewString(
@@ -263,6 +263,9 @@ TEST(WorkListTest, SingleSegmentSteal) {
   }
   EXPECT_TRUE(worklist.IsEmpty());
   EXPECT_EQ(0U, worklist.Size());
+  // Failed attempts to take a segment are not counted.
+  EXPECT_EQ(1U, worklist_local2.SegmentsTakenFromGlobal());
+  EXPECT_EQ(0U, worklist_local1.SegmentsTakenFromGlobal());
 }
 
 TEST(WorkListTest, MultipleSegmentsStolen) {
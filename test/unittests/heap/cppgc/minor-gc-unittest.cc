@@ -878,6 +878,31 @@ TEST_F(MinorGCTest, RevisitNestedInConstructionObjects) {
   EXPECT_EQ(0u, RememberedInConstructionObjects().size());
 }
 
+class MinorGCPublicAPITest : public testing::TestWithPlatform {};
+
+TEST_F(MinorGCPublicAPITest, YoungGenerationSupportFromHeapOptions) {
+  cppgc::Heap::HeapOptions options;
+  options.young_generation_support = true;
+  auto heap = cppgc::Heap::Create(GetPlatformHandle(), std::move(options));
+  SimpleGCedBase::destructed_objects = 0;
+  // The first collection is a full collection that enables generational GC.
+  heap->ForceYoungGarbageCollectionSlow(
+      "test", "testing", cppgc::EmbedderStackState::kNoHeapPointers);
+  EXPECT_TRUE(Heap::From(heap.get())->generational_gc_supported());
+
+  Persistent<Small> old_object =
+      MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+  heap->ForceYoungGarbageCollectionSlow(
+      "test", "testing", cppgc::EmbedderStackState::kNoHeapPointers);
+  EXPECT_TRUE(IsHeapObjectOld(old_object.Get()));
+
+  MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+  heap->ForceYoungGarbageCollectionSlow(
+      "test", "testing", cppgc::EmbedderStackState::kNoHeapPointers);
+  EXPECT_EQ(1u, SimpleGCedBase::destructed_objects);
+  EXPECT_TRUE(IsHeapObjectOld(old_object.Get()));
+}
+
 }  // namespace internal
 }  // namespace cppgc
 
@@ -294,5 +294,31 @@ TEST(PageBackendDeathTest, DestructingBackendDestroysPageMemory) {
   EXPECT_DEATH_IF_SUPPORTED(access(base[0]), "");
 }
 
+TEST(PageBackendPoolTest, ProcessWidePoolRecyclesPagesAcrossBackends) {
+  // Pooled regions refer to their allocator which thus has to outlive them.
+  static v8::base::PageAllocator allocator;
+  auto& process_pool = ProcessWidePageMemoryPool::Instance();
+  Address writeable_base1;
+  {
+    PageBackend backend(allocator, allocator);
+    backend.EnableProcessWidePagePool();
+    writeable_base1 = backend.TryAllocateNormalPageMemory();
+    backend.FreeNormalPageMemory(writeable_base1);
+  }
+  {
+    // Backends that did not opt in don't take pages from the pool.
+    PageBackend backend(allocator, allocator);
+    Address writeable_base2 = backend.TryAllocateNormalPageMemory();
+    EXPECT_NE(writeable_base1, writeable_base2);
+  }
+  const size_t pooled = process_pool.pooled();
+  PageBackend backend(allocator, allocator);
+  backend.EnableProcessWidePagePool();
+  Address writeable_base3 = backend.TryAllocateNormalPageMemory();
+  EXPECT_EQ(writeable_base1, writeable_base3);
+  EXPECT_EQ(pooled - 1, process_pool.pooled());
+  EXPECT_EQ(writeable_base3, backend.Lookup(writeable_base3));
+}
+
 }  // namespace internal
 }  // namespace cppgc
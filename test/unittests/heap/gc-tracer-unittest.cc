@@ -327,6 +327,36 @@ TEST_F(GCTracerTest, MutatorUtilization) {
                    tracer->AverageMarkCompactMutatorUtilization());
 }
 
+TEST_F(GCTracerTest, PauseBudget) {
+  if (v8_flags.stress_incremental_marking) return;
+  Heap* heap = i_isolate()->heap();
+  GCTracer* tracer = heap->tracer();
+  tracer->ResetForTesting();
+  tracer->SetPauseBudget(base::TimeDelta::FromMilliseconds(10));
+
+  // A pause within the budget is not recorded as a violation.
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(100));
+  StopTracing(heap, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(105));
+  EXPECT_EQ(0u, tracer->pause_budget_violations());
+
+  // A pause exceeding the budget is.
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(200));
+  StopTracing(heap, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(220));
+  EXPECT_EQ(1u, tracer->pause_budget_violations());
+
+  // Without a budget no violations are recorded.
+  tracer->SetPauseBudget(base::TimeDelta());
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(300));
+  StopTracing(heap, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(350));
+  EXPECT_EQ(1u, tracer->pause_budget_violations());
+}
+
 TEST_F(GCTracerTest, BackgroundScavengerScope) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
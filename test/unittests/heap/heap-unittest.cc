@@ -32,6 +32,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-collection-inl.h"
 #include "src/sandbox/external-pointer-table.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -864,6 +865,53 @@ TEST_F(HeapTest, PrecisePinningScavengerDoesntMoveObjectReachableFromHandles) {
   CHECK_EQ(number_address, number->address());
 }
 
+TEST_F(HeapTest, ScavengerDeduplicatesPromotedStrings) {
+  if (v8_flags.single_generation) return;
+  if (v8_flags.minor_ms) return;
+  FlagScope<bool> deduplication(&v8_flags.scavenger_string_deduplication,
+                                true);
+  // Deduplication is local to each scavenger task.
+  FlagScope<bool> no_parallel_scavenge(&v8_flags.parallel_scavenge, false);
+  FlagScope<bool> no_conservative_pinning(
+      &v8_flags.scavenger_conservative_object_pinning, false);
+  FlagScope<bool> no_precise_pinning(
+      &v8_flags.scavenger_precise_object_pinning, false);
+  ManualGCScope manual_gc_scope(isolate());
+
+  v8::HandleScope handle_scope(reinterpret_cast<v8::Isolate*>(isolate()));
+  Factory* factory = isolate()->factory();
+  // The strings are only reachable through the array, so the scavenger
+  // evacuates them rather than pinning them.
+  IndirectHandle<FixedArray> strings = factory->NewFixedArray(4);
+  for (int i = 0; i < strings->length(); i++) {
+    DirectHandle<String> string =
+        factory->NewStringFromAsciiChecked("deduplicated");
+    CHECK(IsSeqOneByteString(*string));
+    CHECK(!IsInternalizedString(*string));
+    // Only strings with a computed hash are candidates.
+    if (i < 2) string->EnsureHash();
+    strings->set(i, *string);
+  }
+
+  // The first scavenge moves the strings to the intermediate generation, the
+  // second one promotes them.
+  InvokeMinorGC();
+  InvokeMinorGC();
+  for (int i = 0; i < strings->length(); i++) {
+    CHECK(!HeapLayout::InYoungGeneration(strings->get(i)));
+  }
+
+  // The strings with a hash now share a single copy.
+  CHECK_EQ(strings->get(0), strings->get(1));
+  // The others were promoted separately.
+  CHECK_NE(strings->get(0), strings->get(2));
+  CHECK_NE(strings->get(2), strings->get(3));
+  for (int i = 0; i < strings->length(); i++) {
+    CHECK(Cast<String>(strings->get(i))->IsOneByteEqualTo(
+        base::StaticCharVector("deduplicated")));
+  }
+}
+
 TEST_F(HeapTest,
        PrecisePinningFullGCDoesntMoveYoungObjectReachableFromHandles) {
   if (v8_flags.single_generation) return;
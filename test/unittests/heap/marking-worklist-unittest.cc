@@ -6,6 +6,7 @@
 
 #include <cmath>
 #include <limits>
+#include <set>
 
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
@@ -143,5 +144,57 @@ TEST_F(MarkingWorklistTest, ContextWorklistCrossTask) {
   holder.ReleaseContextWorklists();
 }
 
+TEST_F(MarkingWorklistTest, PrefetcherPopsAllObjects) {
+  MarkingWorklists holder;
+  MarkingWorklists::Local worklists(&holder);
+  HandleScope scope(i_isolate());
+  constexpr int kObjects = 3 * MarkingWorklistPrefetcher::kPrefetchDistance;
+  std::set<Address> pushed;
+  for (int i = 0; i < kObjects; i++) {
+    Tagged<HeapObject> object = *i_isolate()->factory()->NewFixedArray(1);
+    pushed.insert(object.address());
+    worklists.Push(object);
+  }
+  MarkingWorklistPrefetcher prefetcher(&worklists);
+  std::set<Address> popped;
+  Tagged<HeapObject> popped_object;
+  while (prefetcher.Pop(&popped_object)) {
+    EXPECT_TRUE(popped.insert(popped_object.address()).second);
+    // Objects pushed while popping ahead are still returned.
+    if (popped.size() == 1) {
+      Tagged<HeapObject> object = *i_isolate()->factory()->NewFixedArray(1);
+      pushed.insert(object.address());
+      worklists.Push(object);
+    }
+  }
+  EXPECT_EQ(pushed, popped);
+  EXPECT_TRUE(worklists.IsEmpty());
+}
+
+TEST_F(MarkingWorklistTest, PrefetcherFlush) {
+  MarkingWorklists holder;
+  MarkingWorklists::Local worklists(&holder);
+  HandleScope scope(i_isolate());
+  constexpr int kObjects = 2 * MarkingWorklistPrefetcher::kPrefetchDistance;
+  std::set<Address> pushed;
+  for (int i = 0; i < kObjects; i++) {
+    Tagged<HeapObject> object = *i_isolate()->factory()->NewFixedArray(1);
+    pushed.insert(object.address());
+    worklists.Push(object);
+  }
+  std::set<Address> popped;
+  Tagged<HeapObject> popped_object;
+  {
+    MarkingWorklistPrefetcher prefetcher(&worklists);
+    EXPECT_TRUE(prefetcher.Pop(&popped_object));
+    popped.insert(popped_object.address());
+    prefetcher.Flush();
+  }
+  while (worklists.Pop(&popped_object)) {
+    EXPECT_TRUE(popped.insert(popped_object.address()).second);
+  }
+  EXPECT_EQ(pushed, popped);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -12,6 +12,7 @@
 #include "src/heap/memory-pool.h"
 #include "src/heap/spaces-inl.h"
 #include "src/utils/ostreams.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -392,6 +393,31 @@ TEST_F(PoolTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(chunk_address, page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+TEST_F(PoolTest, RetainPagesOnLastTeardown) {
+  FlagScope<size_t> retained_pages_scope(
+      &v8_flags.memory_pool_retained_pages_on_last_teardown, 2);
+  static constexpr size_t kPages = 3;
+  for (size_t i = 0; i < kPages; i++) {
+    PageMetadata* page = allocator()->AllocatePage(
+        MemoryAllocator::AllocationMode::kRegular,
+        static_cast<PagedSpace*>(heap()->old_space()),
+        Executability::NOT_EXECUTABLE);
+    EXPECT_NE(nullptr, page);
+    allocator()->Free(MemoryAllocator::FreeMode::kPool, page);
+  }
+  EXPECT_LE(kPages, pool()->GetCount(i_isolate()));
+
+  // The test isolate is the only one in its group, so this takes the path
+  // for the last isolate going away.
+  pool()->ReleaseOnTearDown(i_isolate());
+  EXPECT_EQ(0u, pool()->GetCount(i_isolate()));
+  EXPECT_EQ(2u, pool()->GetSharedCount());
+
+  // Retained pages are only freed when the pool is released entirely.
+  pool()->ReleaseAllImmediately();
+  EXPECT_EQ(0u, pool()->GetTotalCount());
+}
 #endif  // !V8_OS_FUCHSIA && !V8_ENABLE_SANDBOX
 
 }  // namespace internal
@@ -264,8 +264,17 @@ class TestCodeEventHandler : public v8::CodeEventHandler {
     std::string log_line = "";
     log_line += v8::CodeEvent::GetCodeEventTypeName(code_event->GetCodeType());
     log_line += " ";
-    log_line += FormatName(code_event);
+    std::string name = FormatName(code_event);
+    log_line += name;
     event_log_.push_back(log_line);
+    tier_log_.emplace_back(name, code_event->GetCodeTier());
+  }
+
+  bool HasTier(const std::string& name, v8::CodeEventTier tier) {
+    for (const auto& [logged_name, logged_tier] : tier_log_) {
+      if (logged_tier == tier && logged_name == name) return true;
+    }
+    return false;
   }
 
  private:
@@ -285,6 +294,7 @@ class TestCodeEventHandler : public v8::CodeEventHandler {
   }
 
   std::vector<std::string> event_log_;
+  std::vector<std::pair<std::string, v8::CodeEventTier>> tier_log_;
   v8::Isolate* isolate_;
 };
 
@@ -714,6 +724,40 @@ TEST_F(LogExternalLogEventListenerTest, ExternalLogEventListener) {
   }
 }
 
+class LogExternalLogEventListenerTierTest : public TestWithIsolate {
+ public:
+  static void SetUpTestSuite() {
+    i::v8_flags.log = false;
+    i::v8_flags.prof = false;
+    i::v8_flags.allow_natives_syntax = true;
+    TestWithIsolate::SetUpTestSuite();
+  }
+};
+
+TEST_F(LogExternalLogEventListenerTierTest, CodeTier) {
+  v8::HandleScope scope(isolate());
+  v8::Isolate::Scope isolate_scope(isolate());
+  v8::Local<v8::Context> context = v8::Context::New(isolate());
+  v8::Context::Scope context_scope(context);
+
+  TestCodeEventHandler code_event_handler(isolate());
+  code_event_handler.Enable();
+
+  RunJS(
+      "function testCodeTier(a, b) { return a + b };"
+      "%PrepareFunctionForOptimization(testCodeTier);"
+      "testCodeTier(1, 2);");
+  CHECK(code_event_handler.HasTier("testCodeTier",
+                                   v8::CodeEventTier::kInterpreter));
+
+  if (!i::v8_flags.turbofan || i::v8_flags.jitless) return;
+  RunJS(
+      "%OptimizeFunctionOnNextCall(testCodeTier);"
+      "testCodeTier(1, 2);");
+  CHECK(code_event_handler.HasTier("testCodeTier",
+                                   v8::CodeEventTier::kTurbofan));
+}
+
 class LogExternalLogEventListenerInnerFunctionTest : public TestWithPlatform {
  public:
   LogExternalLogEventListenerInnerFunctionTest()
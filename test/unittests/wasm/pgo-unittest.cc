@@ -0,0 +1,83 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include "src/wasm/wasm-module.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8::internal::wasm {
+
+class WasmPGOTest : public TestWithPlatform {
+ protected:
+  static void InitModule(WasmModule* module, uint32_t num_functions) {
+    module->num_declared_functions = num_functions;
+  }
+
+  // Creates a profile in which function 0 calls function 1, which got
+  // executed but not tiered up.
+  static base::OwnedVector<uint8_t> CreateProfile() {
+    WasmModule module;
+    InitModule(&module, 2);
+    FunctionTypeFeedback& feedback =
+        module.type_feedback.feedback_for_function[0];
+    feedback.feedback_vector =
+        base::OwnedVector<CallSiteFeedback>::NewForOverwrite(1);
+    feedback.feedback_vector[0] = CallSiteFeedback{1, 7};
+    feedback.call_targets = base::OwnedVector<uint32_t>::NewForOverwrite(1);
+    feedback.call_targets[0] = 1;
+
+    std::atomic<uint32_t> budgets[2];
+    budgets[0].store(v8_flags.wasm_tiering_budget);
+    budgets[1].store(v8_flags.wasm_tiering_budget - 1);
+    return GetProfileData(&module, budgets);
+  }
+};
+
+TEST_F(WasmPGOTest, RoundTrip) {
+  base::OwnedVector<uint8_t> profile = CreateProfile();
+
+  WasmModule module;
+  InitModule(&module, 2);
+  std::unique_ptr<ProfileInformation> info =
+      RestoreProfileData(&module, profile.as_vector());
+  ASSERT_NE(nullptr, info);
+  EXPECT_EQ(0u, info->tiered_up_functions().size());
+  ASSERT_EQ(1u, info->executed_functions().size());
+  EXPECT_EQ(1u, info->executed_functions()[0]);
+
+  const FunctionTypeFeedback& feedback =
+      module.type_feedback.feedback_for_function.at(0);
+  ASSERT_EQ(1u, feedback.feedback_vector.size());
+  ASSERT_EQ(1, feedback.feedback_vector[0].num_cases());
+  EXPECT_EQ(1, feedback.feedback_vector[0].function_index(0));
+  EXPECT_EQ(7, feedback.feedback_vector[0].call_count(0));
+  ASSERT_EQ(1u, feedback.call_targets.size());
+  EXPECT_EQ(1u, feedback.call_targets[0]);
+}
+
+TEST_F(WasmPGOTest, TruncatedProfileIsIgnored) {
+  base::OwnedVector<uint8_t> profile = CreateProfile();
+
+  for (size_t length = 0; length < profile.size(); ++length) {
+    WasmModule module;
+    InitModule(&module, 2);
+    EXPECT_EQ(nullptr,
+              RestoreProfileData(&module, profile.as_vector().SubVector(
+                                              0, length)));
+    EXPECT_TRUE(module.type_feedback.feedback_for_function.empty());
+  }
+}
+
+TEST_F(WasmPGOTest, ProfileOfOtherModuleIsIgnored) {
+  base::OwnedVector<uint8_t> profile = CreateProfile();
+
+  // The profile refers to function 1, which does not exist here.
+  WasmModule module;
+  InitModule(&module, 1);
+  EXPECT_EQ(nullptr, RestoreProfileData(&module, profile.as_vector()));
+  EXPECT_TRUE(module.type_feedback.feedback_for_function.empty());
+}
+
+}  // namespace v8::internal::wasm
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+
+# Copyright 2026 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can
+# be found in the LICENSE file.
+"""
+This script converts samples recorded with Linux perf into a builtins profile
+that mksnapshot can use to reorder the embedded builtins (including bytecode
+handlers) by hotness, without a build with v8_enable_builtins_profiling = true.
+The output has the format:
+
+builtin_count,<builtin_name>,<normalized_sample_count>
+
+Usage:
+    perf record -g -k mono d8 --perf-prof ... script.js
+    perf script -F sym > samples.txt
+    perf_to_profile.py samples.txt output_file
+
+and build with
+
+    v8_builtins_profiling_log_file = "output_file"
+    v8_enable_builtins_reordering = true
+
+Only hotness is recorded, i.e. builtins are ordered by their sample density
+but not clustered along the call graph.
+"""
+
+import argparse
+import collections
+import re
+
+PARSER = argparse.ArgumentParser(
+    description="A script that converts perf samples into a builtins profile "
+    "for builtins reordering")
+PARSER.add_argument(
+    'samples_file',
+    help="The output of `perf script -F sym` for a run of V8 with --perf-prof "
+    "or --perf-basic-prof")
+PARSER.add_argument(
+    'output_file', help="The file which the builtins profile is written to")
+
+NORMALIZED_BUILTIN_COUNT_MARKER = "builtin_count"
+MAX_NORMALIZED_COUNT = 10000
+
+# Embedded builtins are logged as "Builtin:<name>" and bytecode handlers as
+# "BytecodeHandler:<bytecode>[.<prefix>]", e.g. "BytecodeHandler:LdaZero.Wide".
+SYMBOL_RE = re.compile(r'\b(Builtin|BytecodeHandler):([\w.]+)')
+
+
+def bytecode_handler_builtin_name(name):
+  # Mirrors the naming in src/builtins/generate-bytecodes-builtins-list.cc:
+  # "LdaZero" -> "LdaZeroHandler", "LdaZero.Wide" -> "LdaZeroWideHandler".
+  # The handler for Star0 is shared by all short star bytecodes.
+  bytecode, _, prefix = name.partition(".")
+  if bytecode == "Star0" and not prefix:
+    bytecode = "ShortStar"
+  return bytecode + prefix + "Handler"
+
+
+def count_samples(samples_file):
+  counts = collections.Counter()
+  with open(samples_file, "r") as f:
+    for line in f:
+      match = SYMBOL_RE.search(line)
+      if not match:
+        continue
+      kind, name = match.groups()
+      if kind == "BytecodeHandler":
+        name = bytecode_handler_builtin_name(name)
+      counts[name] += 1
+  return counts
+
+
+def write_profile(counts, output_file):
+  max_count = max(counts.values(), default=0)
+  with open(output_file, "w") as f:
+    for name, count in counts.most_common():
+      normalized = count * MAX_NORMALIZED_COUNT // max_count
+      if normalized == 0:
+        break
+      f.write(f"{NORMALIZED_BUILTIN_COUNT_MARKER},{name},{normalized}\n")
+
+
+if __name__ == "__main__":
+  args = PARSER.parse_args()
+  write_profile(count_samples(args.samples_file), args.output_file)